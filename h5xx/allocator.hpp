@@ -0,0 +1,208 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_ALLOCATOR_HPP
+#define H5XX_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if defined(_WIN32)
+# include <malloc.h>
+#else
+# include <sys/mman.h>
+#endif
+
+namespace h5xx {
+
+/** size of a transparent huge page on x86-64 and most other platforms */
+enum { huge_page_size = 1 << 21 };
+
+/**
+ * Allocator for memory aligned to 'Alignment' bytes, for use with
+ * std::vector and boost::multi_array as targets of read_dataset() and
+ * write_dataset().
+ *
+ * With HugePages = true, allocations of at least huge_page_size bytes are
+ * aligned to and padded to huge pages, and the kernel is advised to back
+ * them by transparent huge pages (Linux only, madvise(MADV_HUGEPAGE)). This
+ * reduces TLB misses and page faults for buffers of many megabytes.
+ */
+template <typename T, std::size_t Alignment = 64, bool HugePages = false>
+class aligned_allocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0 && Alignment % sizeof(void*) == 0
+      , "alignment must be a power of two and a multiple of the pointer size");
+
+public:
+    typedef T value_type;
+    typedef T* pointer;
+    typedef T const* const_pointer;
+    typedef T& reference;
+    typedef T const& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef aligned_allocator<U, Alignment, HugePages> other;
+    };
+
+    aligned_allocator() noexcept {}
+
+    template <typename U>
+    aligned_allocator(aligned_allocator<U, Alignment, HugePages> const&) noexcept {}
+
+    /** allocate uninitialised memory for n objects, throws std::bad_alloc */
+    T* allocate(size_type n, void const* = 0);
+
+    void deallocate(T* p, size_type) noexcept
+    {
+#if defined(_WIN32)
+        _aligned_free(p);
+#else
+        std::free(p);
+#endif
+    }
+
+    size_type max_size() const noexcept
+    {
+        return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    void destroy(U* p)
+    {
+        p->~U();
+    }
+};
+
+template <typename T, std::size_t Alignment, bool HugePages>
+inline T* aligned_allocator<T, Alignment, HugePages>::allocate(size_type n, void const*)
+{
+    if (n > max_size()) {
+        throw std::bad_alloc();
+    }
+    std::size_t bytes = n * sizeof(T);
+    std::size_t alignment = Alignment;
+    bool huge = HugePages && bytes >= std::size_t(huge_page_size);
+    if (huge) {
+        alignment = std::max<std::size_t>(alignment, huge_page_size);
+        bytes = (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+    }
+
+    void* p = NULL;
+#if defined(_WIN32)
+    p = _aligned_malloc(bytes > 0 ? bytes : 1, alignment);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+#else
+    if (posix_memalign(&p, alignment, bytes > 0 ? bytes : 1) != 0) {
+        throw std::bad_alloc();
+    }
+# ifdef MADV_HUGEPAGE
+    if (huge) {
+        madvise(p, bytes, MADV_HUGEPAGE);   // advisory only, failure is harmless
+    }
+# endif
+#endif
+    return static_cast<T*>(p);
+}
+
+template <typename T, typename U, std::size_t Alignment, bool HugePages>
+inline bool operator==(aligned_allocator<T, Alignment, HugePages> const&, aligned_allocator<U, Alignment, HugePages> const&)
+{
+    return true;
+}
+
+template <typename T, typename U, std::size_t Alignment, bool HugePages>
+inline bool operator!=(aligned_allocator<T, Alignment, HugePages> const&, aligned_allocator<U, Alignment, HugePages> const&)
+{
+    return false;
+}
+
+/** stateless, overload disambiguates from h5xx::swap(h5xxObject&, h5xxObject&) */
+template <typename T, std::size_t Alignment, bool HugePages>
+inline void swap(aligned_allocator<T, Alignment, HugePages>&, aligned_allocator<T, Alignment, HugePages>&) noexcept
+{}
+
+/** page-aligned memory, e.g., for direct I/O */
+template <typename T>
+using page_aligned_allocator = aligned_allocator<T, 4096>;
+
+/** cache-line aligned memory backed by transparent huge pages where possible */
+template <typename T>
+using hugepage_allocator = aligned_allocator<T, 64, true>;
+
+namespace detail {
+
+/**
+ * Allocator of raw memory for buffers related to a container with allocator
+ * Alloc: Alloc rebound to char, and aligned memory in place of std::allocator.
+ */
+template <typename Alloc>
+struct raw_allocator
+{
+    typedef typename std::allocator_traits<Alloc>::template rebind_alloc<char> type;
+};
+
+template <typename T>
+struct raw_allocator<std::allocator<T> >
+{
+    typedef aligned_allocator<char> type;
+};
+
+/**
+ * Uninitialised memory of fixed size, owned by the object, from the (stateless)
+ * allocator raw_allocator<Alloc>::type.
+ */
+template <typename Alloc = std::allocator<char> >
+class raw_buffer
+{
+public:
+    explicit raw_buffer(std::size_t size)
+      : size_(size), data_(allocator_type().allocate(size))
+    {}
+
+    ~raw_buffer()
+    {
+        allocator_type().deallocate(data_, size_);
+    }
+
+    void* data() { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+    typedef typename raw_allocator<Alloc>::type allocator_type;
+
+    raw_buffer(raw_buffer const&) = delete;
+    raw_buffer& operator=(raw_buffer const&) = delete;
+
+    std::size_t size_;
+    char* data_;
+};
+
+} // namespace detail
+} // namespace h5xx
+
+#endif /* ! H5XX_ALLOCATOR_HPP */
@@ -17,6 +17,8 @@
 #include <h5xx/attribute/attribute.hpp>
 #include <h5xx/attribute/boost_array.hpp>
 #include <h5xx/attribute/boost_multi_array.hpp>
+#include <h5xx/attribute/container.hpp>
+#include <h5xx/attribute/map.hpp>
 #include <h5xx/attribute/scalar.hpp>
 #include <h5xx/attribute/std_vector.hpp>
 #include <h5xx/attribute/utility.hpp>
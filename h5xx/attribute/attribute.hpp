@@ -16,6 +16,7 @@
 #include <h5xx/hdf5_compat.hpp>
 #include <h5xx/dataspace.hpp>
 #include <h5xx/error.hpp>
+#include <h5xx/instrument.hpp>
 #include <h5xx/utility.hpp>
 
 namespace h5xx {
@@ -130,7 +131,7 @@ attribute::attribute(h5xxObject const& object, std::string const& name, hid_t aa
         hid_ = H5Aopen(obj_hid, attr_name, aapl_id);
     }
     if (hid_ < 0){
-        throw error("opening attribute \"" + name + "\" at HDF5 object \"" + get_name(object) + "\"");
+        throw error(status(status::not_found, "opening attribute", name, object.hid()));
     }
 }
 
@@ -150,10 +151,9 @@ inline attribute & attribute::operator=(attribute other)
 
 inline attribute::~attribute()
 {
+    // destructors must not throw, a failure cannot be reported
     if (hid_ >= 0) {
-        if(H5Aclose(hid_) < 0){
-            throw error("closing h5xx::attribute with ID " + boost::lexical_cast<std::string>(hid_));
-        }
+        H5Aclose(hid_);
         hid_ = -1;
     }
 }
@@ -173,18 +173,22 @@ inline attribute::operator dataspace() const
 
 inline void attribute::write(hid_t mem_type_id, void const* value)
 {
+    detail::instrument_probe probe(hid_, true, mem_type_id, H5S_ALL, H5S_ALL);
     if (H5Awrite(hid_, mem_type_id, value) < 0)
     {
         throw error("writing attribute \"" + name() + "\"");
     }
+    probe.done();
 }
 
 inline void attribute::read(hid_t mem_type_id, void * buffer)
 {
+    detail::instrument_probe probe(hid_, false, mem_type_id, H5S_ALL, H5S_ALL);
     if (H5Aread(hid_, mem_type_id, buffer) < 0)
     {
         throw error("reading attribute \"" + name() + "\"");
     }
+    probe.done();
 }
 
 inline hid_t attribute::get_type()
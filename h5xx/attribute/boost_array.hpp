@@ -42,8 +42,7 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
     typedef typename T::value_type value_type;
     boost::array<hsize_t, 1> dims = {{ T::static_size }};
 
-    delete_attribute(object, name);
-    attribute attr(object, name, ctype<value_type>::hid(), dataspace(dims));
+    attribute attr(detail::open_or_create_attribute(object, name, ctype<value_type>::hid(), dataspace(dims)));
     attr.write(ctype<value_type>::hid(), &*value.begin());
 }
 
@@ -79,7 +78,6 @@ inline typename boost::enable_if<boost::mpl::and_<
 write_attribute(h5xxObject const& object, std::string const& name, T const& value, StringPolicy policy = StringPolicy())
 {
     enum { size = T::static_size };
-    delete_attribute(object, name);
 
     // determine the maximum string size
     size_t str_size = 0;
@@ -89,8 +87,8 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
 
     // create type, space and attribute
     boost::array<hsize_t, 1> dims = {{ size }};
-    hid_t type_id = policy.make_type(str_size);
-    attribute attr(object, name, type_id, dataspace(dims));
+    hid_t type_id = policy.cached_type(str_size);
+    attribute attr(detail::open_or_create_attribute(object, name, type_id, dataspace(dims)));
 
     // write attribute
     if (StringPolicy::is_variable_length) {
@@ -107,7 +105,7 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
         }
         attr.write(type_id, &*buffer.begin());
     }
-    H5Tclose(type_id);
+    detail::release_type(type_id);
 }
 
 template <typename T, typename h5xxObject>
@@ -151,17 +149,14 @@ read_attribute(h5xxObject const& object, std::string const& name)
     if (!is_varlen_str){
         // create memory datatype with matching size and padding,
         // convert space padding to null padding
-        hid_t mem_type_id = H5Tcopy(H5T_C_S1);
         hsize_t str_size = H5Tget_size(type_id);
-        err |= H5Tset_size(mem_type_id, str_size) < 0;
-        if (H5Tget_strpad(type_id) != H5T_STR_NULLTERM) {
-            H5Tset_strpad(mem_type_id, H5T_STR_NULLPAD);
-        }
+        hid_t mem_type_id = detail::cached_string_type(str_size
+          , H5Tget_strpad(type_id) != H5T_STR_NULLTERM ? H5T_STR_NULLPAD : H5T_STR_NULLTERM);
 
         // read from opened object
         std::vector<char> buffer(str_size * size);
         attr.read(mem_type_id, &*buffer.begin());
-        err |= H5Tclose(mem_type_id) < 0;
+        err |= detail::release_type(mem_type_id) < 0;
 
         char const* s = &*buffer.begin();
         for (unsigned int i = 0; i < size; ++i, s += str_size) {
@@ -203,15 +198,12 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
         str_size = std::max(str_size, strlen(value[i]));
     }
 
-    // remove attribute if it exists
-    delete_attribute(object, name);
-
     boost::array<hsize_t, 1> dims = {{ size }};
     dataspace space(dims);
 
-    hid_t type_id = policy.make_type(str_size);
+    hid_t type_id = policy.cached_type(str_size);
     assert(type_id >= 0);
-    attribute attr(object, name, type_id, space);
+    attribute attr(detail::open_or_create_attribute(object, name, type_id, space));
 
     if (StringPolicy::is_variable_length) {
         attr.write(type_id, &*value.begin());
@@ -224,7 +216,7 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
         attr.write(type_id, &*data.begin());
     }
 
-    if (H5Tclose(type_id) < 0) {
+    if (detail::release_type(type_id) < 0) {
         throw error("closing datatype");
     }
 }
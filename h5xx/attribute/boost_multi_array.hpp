@@ -39,14 +39,11 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
     typedef typename T::element value_type;
     enum { rank = T::dimensionality };
 
-    // remove attribute if it exists
-    delete_attribute(object, name);
-
     // create attribute with given dimensions
     boost::array<hsize_t, rank> dims;
     std::copy(value.shape(), value.shape() + rank, dims.begin());
     hid_t type_id = ctype<value_type>::hid();       // this ID must not be closed
-    attribute attr(object, name, type_id, dataspace(dims));
+    attribute attr(detail::open_or_create_attribute(object, name, type_id, dataspace(dims)));
 
     // write attribute
     attr.write(type_id, value.origin());
@@ -0,0 +1,247 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_ATTRIBUTE_CONTAINER_HPP
+#define H5XX_ATTRIBUTE_CONTAINER_HPP
+
+#include <h5xx/attribute/attribute.hpp>
+#include <h5xx/error.hpp>
+#include <h5xx/utility.hpp>
+
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace h5xx {
+
+// forward declaration
+template <typename h5xxObject>
+class container;
+
+/**
+ * iterator over the attributes of an HDF5 object
+ *
+ * Attributes are addressed by their position in the index, which is the
+ * creation order if the object maintains an index on it (see
+ * group_options::attr_index_order and policy::storage::attribute_storage),
+ * and the order of names otherwise. The attribute is opened lazily upon
+ * dereferencing.
+ */
+template <bool is_const>
+class attribute_iterator
+  : public std::iterator<std::forward_iterator_tag
+     , attribute
+     , std::ptrdiff_t
+     , typename std::conditional<is_const, attribute const*, attribute*>::type
+     , typename std::conditional<is_const, attribute const&, attribute&>::type
+    >
+{
+public:
+    attribute_iterator() noexcept {}
+    ~attribute_iterator() noexcept { delete element_; }
+
+    /** construct iterator pointing at given position in the index */
+    attribute_iterator(hid_t parent, H5_index_t index, hsize_t idx) noexcept
+      : parent_(parent), index_(index), idx_(idx)
+    {}
+
+    /** copy constructor, don't copy resource pointer */
+    attribute_iterator(attribute_iterator const& other) noexcept
+      : parent_(other.parent_), index_(other.index_), idx_(other.idx_)
+    {}
+
+    /** copy assignment, don't copy resource pointer */
+    attribute_iterator& operator=(attribute_iterator const& other)
+    {
+        if (this != &other) {
+            delete element_;
+            element_ = nullptr;
+            parent_ = other.parent_;
+            index_ = other.index_;
+            idx_ = other.idx_;
+        }
+        return *this;
+    }
+
+    /** pre- and post-increment operators */
+    attribute_iterator& operator++()
+    {
+        if (parent_ < 0) {
+            throw error("cannot increment default constructed h5xx::attribute_iterator");
+        }
+        delete element_;
+        element_ = nullptr;
+        ++idx_;
+        return *this;
+    }
+
+    attribute_iterator operator++(int)
+    {
+        attribute_iterator tmp(*this);
+        ++(*this);
+        return tmp;
+    }
+
+    /** returns attribute, reference is to internal copy */
+    typename std::conditional<is_const, attribute const&, attribute&>::type operator*();
+    typename std::conditional<is_const, attribute const*, attribute*>::type operator->()
+    {
+        return &**this;
+    }
+
+    /**
+     * Two iterators are equal if they refer to the same object and point at
+     * the same position in the index.
+     */
+    template <bool is_const2>
+    bool operator==(attribute_iterator<is_const2> const& other) const
+    {
+        if (parent_ != other.parent_) {
+            throw error("comparing iterators over attributes of different objects");
+        }
+        return idx_ == other.idx_;
+    }
+
+    template <bool is_const2>
+    bool operator!=(attribute_iterator<is_const2> const& other) const
+    {
+        return !(*this == other);
+    }
+
+    /** return name of current attribute, without opening it */
+    std::string get_name() const;
+
+private:
+    /** HDF5 object ID of the parent object, not owned by the iterator */
+    hid_t parent_ = -1;
+
+    /** type of index and position of the current attribute in the index */
+    H5_index_t index_ = H5_INDEX_NAME;
+    hsize_t idx_ = 0;
+
+    /** instance of attribute pointed to */
+    attribute* element_ = nullptr;
+
+    template <bool is_const2>
+    friend class attribute_iterator;
+};
+
+template <bool is_const>
+inline typename std::conditional<is_const, attribute const&, attribute&>::type attribute_iterator<is_const>::operator*()
+{
+    if (parent_ < 0) {
+        throw error("cannot dereference default constructed h5xx::attribute_iterator");
+    }
+    if (!element_) {
+        hid_t hid = H5Aopen_by_idx(parent_, ".", index_, H5_ITER_INC, idx_, H5P_DEFAULT, H5P_DEFAULT);
+        if (hid < 0) {
+            throw std::out_of_range("attribute of HDF5 object \"" + h5xx::get_name(parent_) + "\"");
+        }
+        element_ = new attribute(hid);
+    }
+    return *element_;
+}
+
+template <bool is_const>
+inline std::string attribute_iterator<is_const>::get_name() const
+{
+    ssize_t size = H5Aget_name_by_idx(parent_, ".", index_, H5_ITER_INC, idx_, NULL, 0, H5P_DEFAULT);
+    if (size < 0) {
+        throw std::out_of_range("attribute of HDF5 object \"" + h5xx::get_name(parent_) + "\"");
+    }
+    std::vector<char> buffer(size + 1);     // includes NULL terminator
+    H5Aget_name_by_idx(parent_, ".", index_, H5_ITER_INC, idx_, &*buffer.begin(), buffer.size(), H5P_DEFAULT);
+    return &*buffer.begin();
+}
+
+/**
+ * adapter class to use the attributes of a group, dataset, or named datatype
+ * as a container
+ *
+ * Provides an iterator interface and can be used in a range-based loop. The
+ * number of attributes is determined by begin() and end(), the container
+ * does not keep the object alive.
+ */
+template <>
+class container<attribute>
+{
+public:
+    typedef attribute_iterator<false> iterator;
+    typedef attribute_iterator<true> const_iterator;
+
+    template <typename h5xxObject>
+    container(h5xxObject const& object)
+      : parent_(object.hid())
+    {}
+
+    iterator begin() const { return iterator(parent_, index_type(), 0); }
+    iterator end() const { return iterator(parent_, index_type(), size()); }
+
+    const_iterator cbegin() const { return const_iterator(parent_, index_type(), 0); }
+    const_iterator cend() const { return const_iterator(parent_, index_type(), size()); }
+
+    /** number of attributes attached to the object */
+    hsize_t size() const;
+
+    /** creation order if it is indexed, order of names otherwise */
+    H5_index_t index_type() const;
+
+private:
+    hid_t parent_;
+};
+
+inline hsize_t container<attribute>::size() const
+{
+#if H5_VERSION_GE(1,12,0)
+    H5O_info2_t info;
+    herr_t retval = H5Oget_info3(parent_, &info, H5O_INFO_NUM_ATTRS);
+#elif H5_VERSION_GE(1,10,3)
+    H5O_info_t info;
+    herr_t retval = H5Oget_info2(parent_, &info, H5O_INFO_NUM_ATTRS);
+#else
+    H5O_info_t info;
+    herr_t retval = H5Oget_info(parent_, &info);
+#endif
+    if (retval < 0) {
+        throw error("determining number of attributes of HDF5 object with ID " + boost::lexical_cast<std::string>(parent_));
+    }
+    return info.num_attrs;
+}
+
+inline H5_index_t container<attribute>::index_type() const
+{
+    hid_t plist;
+    switch (H5Iget_type(parent_)) {
+      case H5I_GROUP:
+        plist = H5Gget_create_plist(parent_);
+        break;
+      case H5I_DATASET:
+        plist = H5Dget_create_plist(parent_);
+        break;
+      case H5I_DATATYPE:
+        plist = H5Tget_create_plist(parent_);
+        break;
+      default:
+        return H5_INDEX_NAME;
+    }
+
+    unsigned int flags = 0;
+    if (plist >= 0) {
+        H5Pget_attr_creation_order(plist, &flags);
+        H5Pclose(plist);
+    }
+    return (flags & H5P_CRT_ORDER_INDEXED) ? H5_INDEX_CRT_ORDER : H5_INDEX_NAME;
+}
+
+} // namespace h5xx
+
+#endif /* ! H5XX_ATTRIBUTE_CONTAINER_HPP */
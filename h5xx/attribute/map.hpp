@@ -0,0 +1,340 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_ATTRIBUTE_MAP_HPP
+#define H5XX_ATTRIBUTE_MAP_HPP
+
+#include <h5xx/attribute/scalar.hpp>
+#include <h5xx/attribute/std_vector.hpp>
+#include <h5xx/attribute/utility.hpp>
+#include <h5xx/ctype.hpp>
+#include <h5xx/datatype/cache.hpp>
+#include <h5xx/error.hpp>
+#include <h5xx/instrument.hpp>
+#include <h5xx/utility.hpp>
+
+#include <boost/array.hpp>
+#include <boost/variant.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace h5xx {
+
+/**
+ * Value of an attribute of arbitrary numeric or string type. Integral
+ * attributes are widened to (unsigned) long long, floating-point attributes
+ * to double. Attributes with a non-scalar dataspace are flattened into a
+ * std::vector in row-major order.
+ */
+typedef boost::variant<
+    long long, unsigned long long, double, std::string
+  , std::vector<long long>, std::vector<unsigned long long>, std::vector<double>, std::vector<std::string>
+> attribute_value;
+
+/** attributes of an HDF5 object by name */
+typedef std::map<std::string, attribute_value> attribute_map;
+
+namespace detail {
+
+/** read all elements of the attribute with given memory type into a vector */
+template <typename T>
+inline std::vector<T> read_attribute_elements(hid_t attr_id, hid_t mem_type_id, hssize_t size)
+{
+    std::vector<T> value(size);
+    if (size > 0) {
+        instrument_probe probe(attr_id, false, mem_type_id, H5S_ALL, H5S_ALL);
+        if (H5Aread(attr_id, mem_type_id, &*value.begin()) < 0) {
+            throw error("reading attribute");
+        }
+        probe.done();
+    }
+    return value;
+}
+
+/** read fixed or variable-length strings of the attribute, the file type is passed by type_id */
+inline std::vector<std::string> read_attribute_strings(hid_t attr_id, hid_t type_id, hid_t space_id, hssize_t size)
+{
+    std::vector<std::string> value;
+    value.reserve(size);
+
+    bool err = false;
+    hid_t mem_type_id;
+
+    if (H5Tis_variable_str(type_id) > 0) {
+        mem_type_id = cached_string_type(H5T_VARIABLE, H5T_STR_NULLTERM, H5Tget_cset(type_id));
+        std::vector<char*> buffer(size);
+        instrument_probe probe(attr_id, false, mem_type_id, H5S_ALL, H5S_ALL);
+        if (!err && size > 0 && H5Aread(attr_id, mem_type_id, &*buffer.begin()) >= 0) {
+            probe.done();
+            for (hssize_t i = 0; i < size; ++i) {
+                value.push_back(buffer[i] ? buffer[i] : "");
+            }
+            err |= vlen_reclaim(mem_type_id, space_id, H5P_DEFAULT, &*buffer.begin()) < 0;
+        }
+        else {
+            err |= size > 0;
+        }
+    }
+    else {
+        // keep padded strings of full length, which have no room for a terminator
+        size_t str_size = H5Tget_size(type_id);
+        mem_type_id = cached_string_mem_type(type_id);
+        std::vector<char> buffer(size * str_size);
+        instrument_probe probe(attr_id, false, mem_type_id, H5S_ALL, H5S_ALL);
+        if (!err && size > 0 && H5Aread(attr_id, mem_type_id, &*buffer.begin()) >= 0) {
+            probe.done();
+            for (hssize_t i = 0; i < size; ++i) {
+                char const* first = &buffer[i * str_size];
+                value.push_back(std::string(first, std::find(first, first + str_size, '\0')));
+            }
+        }
+        else {
+            err |= size > 0;
+        }
+    }
+
+    err |= release_type(mem_type_id) < 0;
+    if (err) {
+        throw error("reading string attribute");
+    }
+    return value;
+}
+
+/**
+ * convert attribute to a variant value, depending on its type class and
+ * dataspace; returns false for unsupported type classes
+ */
+inline bool read_attribute_value(hid_t attr_id, attribute_value& value)
+{
+    hid_t type_id = H5Aget_type(attr_id);
+    hid_t space_id = H5Aget_space(attr_id);
+    if (type_id < 0 || space_id < 0) {
+        throw error("querying type or space of attribute");
+    }
+    bool scalar = H5Sget_simple_extent_type(space_id) == H5S_SCALAR;
+    hssize_t size = H5Sget_simple_extent_npoints(space_id);
+    H5T_class_t type_class = H5Tget_class(type_id);
+
+    bool supported = true;
+    try {
+        if (type_class == H5T_INTEGER && H5Tget_sign(type_id) == H5T_SGN_NONE) {
+            std::vector<unsigned long long> v = read_attribute_elements<unsigned long long>(attr_id, ctype<unsigned long long>::hid(), size);
+            if (scalar) { value = v.front(); } else { value = v; }
+        }
+        else if (type_class == H5T_INTEGER) {
+            std::vector<long long> v = read_attribute_elements<long long>(attr_id, ctype<long long>::hid(), size);
+            if (scalar) { value = v.front(); } else { value = v; }
+        }
+        else if (type_class == H5T_FLOAT) {
+            std::vector<double> v = read_attribute_elements<double>(attr_id, ctype<double>::hid(), size);
+            if (scalar) { value = v.front(); } else { value = v; }
+        }
+        else if (type_class == H5T_STRING) {
+            std::vector<std::string> v = read_attribute_strings(attr_id, type_id, space_id, size);
+            if (scalar) { value = v.front(); } else { value = v; }
+        }
+        else {
+            supported = false;
+        }
+    }
+    catch (...) {
+        H5Tclose(type_id);
+        H5Sclose(space_id);
+        throw;
+    }
+
+    H5Tclose(type_id);
+    H5Sclose(space_id);
+    return supported;
+}
+
+struct read_all_attributes_data
+{
+    attribute_map* attributes;
+    std::string error_name;
+};
+
+/**
+ * H5Aiterate callback: store the value of each attribute in the map
+ *
+ * @return code: success: 0, error: < 0
+ */
+inline herr_t read_all_attributes_callback(hid_t loc_id, char const* name, H5A_info_t const*, void* op_data)
+{
+    read_all_attributes_data* data = reinterpret_cast<read_all_attributes_data*>(op_data);
+
+    hid_t attr_id = H5Aopen(loc_id, name, H5P_DEFAULT);
+    if (attr_id < 0) {
+        data->error_name = name;
+        return -1;
+    }
+
+    // exceptions must not propagate through the HDF5 library
+    herr_t retval = 0;
+    try {
+        attribute_value value;
+        if (read_attribute_value(attr_id, value)) {
+            (*data->attributes)[name] = value;
+        }
+    }
+    catch (...) {
+        data->error_name = name;
+        retval = -1;
+    }
+
+    H5Aclose(attr_id);
+    return retval;
+}
+
+/** returns true if the value is representable by the given integer type */
+inline bool fits_integer_type(hid_t type_id, unsigned long long value)
+{
+    size_t bits = H5Tget_precision(type_id) - (H5Tget_sign(type_id) != H5T_SGN_NONE);
+    return bits >= 64 || value < (1ULL << bits);
+}
+
+inline bool fits_integer_type(hid_t type_id, long long value)
+{
+    if (value >= 0) {
+        return fits_integer_type(type_id, static_cast<unsigned long long>(value));
+    }
+    size_t bits = H5Tget_precision(type_id);
+    return H5Tget_sign(type_id) != H5T_SGN_NONE && (bits >= 64 || value >= -(1LL << (bits - 1)));
+}
+
+/**
+ * Overwrite an existing integer attribute of equal dataspace extents in
+ * place if all values fit into its integer type, which thus is preserved by
+ * a round trip via read_all_attributes().
+ *
+ * @returns         false if the attribute was not written
+ */
+template <typename h5xxObject, typename T>
+inline bool overwrite_integer_attribute(h5xxObject const& object, std::string const& name, T const* value, hsize_t size, dataspace const& space)
+{
+    if (!exists_attribute(object, name)) {
+        return false;
+    }
+    attribute attr(object, name);
+    hid_t type_id = attr.get_type();
+    bool fits = H5Tget_class(type_id) == H5T_INTEGER && H5Sextent_equal(dataspace(attr).hid(), space.hid()) > 0;
+    for (hsize_t i = 0; fits && i < size; ++i) {
+        fits = fits_integer_type(type_id, value[i]);
+    }
+    H5Tclose(type_id);
+    if (fits && size > 0) {
+        attr.write(ctype<T>::hid(), value);
+    }
+    return fits;
+}
+
+/** write variant attribute value by dispatching to the respective write_attribute() */
+template <typename h5xxObject>
+struct write_attribute_visitor
+  : boost::static_visitor<>
+{
+    h5xxObject const& object;
+    std::string const& name;
+
+    write_attribute_visitor(h5xxObject const& object_, std::string const& name_)
+      : object(object_), name(name_)
+    {}
+
+    template <typename T>
+    void operator()(T const& value) const
+    {
+        write_attribute(object, name, value);
+    }
+
+    // integer values keep the type of an existing attribute
+    void operator()(long long const& value) const
+    {
+        write_integer(value, &value, 1, dataspace(H5S_SCALAR));
+    }
+
+    void operator()(unsigned long long const& value) const
+    {
+        write_integer(value, &value, 1, dataspace(H5S_SCALAR));
+    }
+
+    void operator()(std::vector<long long> const& value) const
+    {
+        write_integer_vector(value);
+    }
+
+    void operator()(std::vector<unsigned long long> const& value) const
+    {
+        write_integer_vector(value);
+    }
+
+private:
+    template <typename T, typename value_type>
+    void write_integer(T const& value, value_type const* first, hsize_t size, dataspace const& space) const
+    {
+        if (!overwrite_integer_attribute(object, name, first, size, space)) {
+            write_attribute(object, name, value);
+        }
+    }
+
+    template <typename T>
+    void write_integer_vector(std::vector<T> const& value) const
+    {
+        boost::array<hsize_t, 1> dims = {{ value.size() }};
+        write_integer(value, value.empty() ? 0 : &value.front(), value.size(), dataspace(dims));
+    }
+};
+
+} // namespace detail
+
+/**
+ * Read all attributes of the given h5xx object in a single pass over its
+ * attributes, in increasing order of names. Attributes of unsupported
+ * types (e.g., compound or enum types) are skipped.
+ *
+ * @param object    one of h5xx::file, h5xx::group, h5xx::dataset, or h5xx::datatype
+ * @returns         map from attribute names to values
+ */
+template <typename h5xxObject>
+inline attribute_map read_all_attributes(h5xxObject const& object)
+{
+    attribute_map attributes;
+    detail::read_all_attributes_data data;
+    data.attributes = &attributes;
+
+    hsize_t idx = 0;
+    if (H5Aiterate2(object.hid(), H5_INDEX_NAME, H5_ITER_INC, &idx, detail::read_all_attributes_callback, &data) < 0) {
+        throw error("reading attribute \"" + data.error_name + "\" of HDF5 object \"" + get_name(object) + "\"");
+    }
+    return attributes;
+}
+
+/**
+ * Write all attributes of the map to the given h5xx object. Existing
+ * attributes of equal type and shape are overwritten in place, others are
+ * replaced. An existing integer attribute of equal shape keeps its integer
+ * type if the values fit.
+ *
+ * @param object    one of h5xx::file, h5xx::group, h5xx::dataset, or h5xx::datatype
+ * @param attributes    map from attribute names to values
+ */
+template <typename h5xxObject>
+inline void write_attributes(h5xxObject const& object, attribute_map const& attributes)
+{
+    for (attribute_map::const_iterator it = attributes.begin(); it != attributes.end(); ++it) {
+        boost::apply_visitor(detail::write_attribute_visitor<h5xxObject>(object, it->first), it->second);
+    }
+}
+
+} // namespace h5xx
+
+#endif /* ! H5XX_ATTRIBUTE_MAP_HPP */
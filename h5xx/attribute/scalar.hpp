@@ -34,8 +34,7 @@ template <typename h5xxObject, typename T>
 inline typename boost::enable_if<boost::is_fundamental<T>, void>::type
 write_attribute(h5xxObject const& object, std::string const& name, T const& value)
 {
-    delete_attribute(object, name);
-    attribute attr(object, name, ctype<T>::hid(), dataspace(H5S_SCALAR));
+    attribute attr(detail::open_or_create_attribute(object, name, ctype<T>::hid(), dataspace(H5S_SCALAR)));
     attr.write(ctype<T>::hid(), &value);
 }
 
@@ -65,9 +64,8 @@ template <typename T, typename h5xxObject, typename StringPolicy> // only in C++
 inline typename boost::enable_if<boost::is_same<T, std::string>, void>::type
 write_attribute(h5xxObject const& object, std::string const& name, T const& value, StringPolicy policy = StringPolicy())
 {
-    hid_t type_id = policy.make_type(value.size());
-    delete_attribute(object, name);
-    attribute attr(object, name, type_id, dataspace(H5S_SCALAR));
+    hid_t type_id = policy.cached_type(value.size());
+    attribute attr(detail::open_or_create_attribute(object, name, type_id, dataspace(H5S_SCALAR)));
     if (StringPolicy::is_variable_length) {
         char const* p = value.c_str();
         attr.write(type_id, &p);
@@ -76,7 +74,7 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
         attr.write(type_id, value.data());
     }
 
-    if (H5Tclose(type_id) < 0) {
+    if (detail::release_type(type_id) < 0) {
         throw error("closing datatype");
     }
 }
@@ -96,10 +94,8 @@ inline typename boost::enable_if<boost::is_same<T, char const*>, void>::type
 write_attribute(h5xxObject const& object, std::string const& name, T value, StringPolicy policy = StringPolicy())
 {
 
-    // remove attribute if it exists
-    delete_attribute(object, name);
-    hid_t type_id = policy.make_type(strlen(value));
-    attribute attr(object, name, type_id, dataspace(H5S_SCALAR));
+    hid_t type_id = policy.cached_type(strlen(value));
+    attribute attr(detail::open_or_create_attribute(object, name, type_id, dataspace(H5S_SCALAR)));
 
     // write data
     if (StringPolicy::is_variable_length) {
@@ -109,7 +105,7 @@ write_attribute(h5xxObject const& object, std::string const& name, T value, Stri
         attr.write(type_id, &*value);
     };
 
-    if (H5Tclose(type_id) < 0) {
+    if (detail::release_type(type_id) < 0) {
         throw error("closing datatype");
     }
 }
@@ -149,14 +145,10 @@ read_attribute(h5xxObject const& object, std::string const& name)
         // read fixed-size string, allocate space in advance and let the HDF5
         // library take care about NULLTERM and NULLPAD strings
         hsize_t size = H5Tget_size(type_id);
-        hid_t mem_type_id = H5Tcopy(H5T_C_S1);
-        err |= H5Tset_size(mem_type_id, size + 1) < 0;  //one extra character for zero- and space-padded strings
-        if (err) {
-            throw error("setting size of mem_type_id");
-        }
+        hid_t mem_type_id = detail::cached_string_type(size + 1);  //one extra character for zero- and space-padded strings
         value.resize(size, std::string::value_type());
         attr.read(mem_type_id, &*value.begin());
-        err |= H5Tclose(mem_type_id);
+        err |= detail::release_type(mem_type_id);
 
     }  else {
         // read variable-length string, memory will be allocated by HDF5 C
@@ -17,6 +17,7 @@
 #include <h5xx/attribute/attribute.hpp>
 #include <h5xx/attribute/utility.hpp>
 #include <h5xx/ctype.hpp>
+#include <h5xx/datatype/cache.hpp>
 #include <h5xx/dataspace.hpp>
 #include <h5xx/error.hpp>
 #include <h5xx/utility.hpp>
@@ -40,12 +41,9 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
 {
     typedef typename T::value_type value_type;
 
-    // remove attribute if it exists
-    delete_attribute(object, name);
-
     hid_t type_id = ctype<value_type>::hid();       // this ID must not be closed
     boost::array<hsize_t, 1> dims = {{ value.size() }};
-    attribute attr(object, name, type_id, dataspace(dims));
+    attribute attr(detail::open_or_create_attribute(object, name, type_id, dataspace(dims)));
 
     attr.write(type_id, &*value.begin());
 }
@@ -88,9 +86,6 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
     size_t size = value.size();
     boost::array<hsize_t, 1> dims = {{ value.size() }};
 
-    // remove attribute if it exists
-    delete_attribute(object, name);
-
     // size of longest string
     size_t str_size = 0;
     for (size_t i = 0; i < size; ++i) {
@@ -98,11 +93,9 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
     }
 
     bool err = false;
-    hid_t type_id = H5Tcopy(H5T_C_S1);
-    err |= H5Tset_size(type_id, str_size) < 0;
-    err |= H5Tset_strpad(type_id, H5T_STR_NULLTERM) < 0;
+    hid_t type_id = detail::cached_string_type(str_size, H5T_STR_NULLTERM);
 
-    attribute attr(object, name, type_id, dataspace(dims));
+    attribute attr(detail::open_or_create_attribute(object, name, type_id, dataspace(dims)));
 
     std::vector<char> buffer(size * str_size);
     for (size_t i = 0; i < size; ++i){
@@ -110,7 +103,7 @@ write_attribute(h5xxObject const& object, std::string const& name, T const& valu
     }
 
     attr.write(type_id, &*buffer.begin());
-    err |= H5Tclose(type_id) < 0;
+    err |= detail::release_type(type_id) < 0;
     if (err) {
         throw error("writing attribute \"" + name + "\" with ID " + boost::lexical_cast<std::string>(attr.hid()));
     }
@@ -135,9 +128,8 @@ read_attribute(h5xxObject const& object, std::string const& name)
 
     bool err = false;
     hid_t type_id = attr.get_type();              // attribute's datatype on disk
-    hid_t mem_type_id = H5Tcopy(H5T_C_S1);        // create memory datatype of same size
     hsize_t str_size = H5Tget_size(type_id);
-    err |= H5Tset_size(mem_type_id, str_size) < 0;
+    hid_t mem_type_id = detail::cached_string_type(str_size);    // memory datatype of same size
 
     // read from opened object to buffer
     hsize_t size = space.extents<1>()[0];
@@ -147,7 +139,7 @@ read_attribute(h5xxObject const& object, std::string const& name)
         throw error("error while reading attribute \"" + name + "\"");
     }
     // close object
-    err |= H5Tclose(mem_type_id) < 0;
+    err |= detail::release_type(mem_type_id) < 0;
     err |= H5Tclose(type_id) < 0;
     if (err) {
         throw error("reading atrribute \"" + name + "\" with ID " + boost::lexical_cast<std::string>(attr.hid()));
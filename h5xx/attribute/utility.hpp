@@ -11,6 +11,7 @@
 #ifndef H5XX_ATTRIBUTE_UTILITY_HPP
 #define H5XX_ATTRIBUTE_UTILITY_HPP
 
+#include <h5xx/dataspace.hpp>
 #include <h5xx/error.hpp>
 #include <h5xx/utility.hpp>
 
@@ -49,6 +50,72 @@ inline void delete_attribute(h5xxObject const& object, std::string const& name)
     }
 }
 
+namespace detail {
+
+/**
+ * Set the attribute storage properties of an object creation property list
+ * (i.e., a group or dataset creation property list). Thresholds with value
+ * zero leave the respective library default untouched.
+ *
+ * @returns         false if one of the properties could not be set
+ */
+inline bool set_attribute_storage(hid_t ocpl, unsigned int max_compact, unsigned int min_dense, bool track_order, bool index_order)
+{
+    bool err = false;
+    if (max_compact > 0 || min_dense > 0) {
+        unsigned int max_compact_ = max_compact, min_dense_ = min_dense;
+        H5Pget_attr_phase_change(ocpl, max_compact > 0 ? NULL : &max_compact_, min_dense > 0 ? NULL : &min_dense_);
+        err |= H5Pset_attr_phase_change(ocpl, max_compact_, min_dense_) < 0;
+    }
+    if (track_order || index_order) {
+        unsigned int flags = H5P_CRT_ORDER_TRACKED | (index_order ? H5P_CRT_ORDER_INDEXED : 0);
+        err |= H5Pset_attr_creation_order(ocpl, flags) < 0;
+    }
+    return !err;
+}
+
+/**
+ * Open the attribute of the given name if it exists with an equal datatype
+ * and the same dataspace extents, so that it can be overwritten in place.
+ * Otherwise, the attribute is deleted if present and created anew.
+ *
+ * @returns         HDF5 ID of the attribute, to be owned by an h5xx::attribute
+ */
+template <typename h5xxObject>
+inline hid_t open_or_create_attribute(h5xxObject const& object, std::string const& name, hid_t type_id, dataspace const& space)
+{
+    hid_t obj_hid = object.hid();
+    char const* attr_name = name.c_str();
+    if (exists_attribute(object, name)) {
+        hid_t attr_id = H5Aopen(obj_hid, attr_name, H5P_DEFAULT);
+        if (attr_id >= 0) {
+            hid_t attr_type = H5Aget_type(attr_id);
+            hid_t attr_space = H5Aget_space(attr_id);
+            bool match = attr_type >= 0 && attr_space >= 0
+                && H5Tequal(attr_type, type_id) > 0 && H5Sextent_equal(attr_space, space.hid()) > 0;
+            if (attr_type >= 0) {
+                H5Tclose(attr_type);
+            }
+            if (attr_space >= 0) {
+                H5Sclose(attr_space);
+            }
+            if (match) {
+                return attr_id;
+            }
+            H5Aclose(attr_id);      // attribute must be closed before deletion
+        }
+        delete_attribute(object, name);
+    }
+
+    hid_t attr_id = H5Acreate(obj_hid, attr_name, type_id, space.hid(), H5P_DEFAULT, H5P_DEFAULT);
+    if (attr_id < 0) {
+        throw error("creating attribute \"" + name + "\"");
+    }
+    return attr_id;
+}
+
+} // namespace detail
+
 } // namespace h5xx
 
 #endif /* ! H5XX_ATTRIBUTE_UTILITY_HPP */
@@ -14,6 +14,19 @@
 #define H5XX_CTYPE_HPP
 
 #include <h5xx/hdf5_compat.hpp>
+#include <h5xx/error.hpp>
+
+#include <boost/array.hpp>
+#include <boost/preprocessor/seq/for_each.hpp>
+#include <boost/preprocessor/stringize.hpp>
+#include <boost/preprocessor/variadic/to_seq.hpp>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/utility/enable_if.hpp>
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <type_traits>
 
 namespace h5xx {
 namespace detail {
@@ -57,7 +70,186 @@ H5XX_MAKE_CTYPE( bool,                  H5T_NATIVE_CHAR ); // ignore unsupported
 
 #undef H5XX_MAKE_CTYPE
 
+/**
+ * Complex numbers are stored as compound type with members "r" and "i", as
+ * used by h5py. The type is created on first use and cached.
+ */
+template <typename T>
+struct ctype<std::complex<T> >
+{
+    static hid_t hid()
+    {
+        static hid_t const type_id = create();
+        return type_id;
+    }
+
+    static hid_t hid_copy()
+    {
+        return H5Tcopy(hid());
+    }
+
+private:
+    static hid_t create()
+    {
+        hid_t type_id = H5Tcreate(H5T_COMPOUND, sizeof(std::complex<T>));
+        if (type_id < 0) {
+            throw error("creating compound datatype for std::complex");
+        }
+        bool err = H5Tinsert(type_id, "r", 0, ctype<T>::hid()) < 0;
+        err |= H5Tinsert(type_id, "i", sizeof(T), ctype<T>::hid()) < 0;
+        if (err) {
+            H5Tclose(type_id);
+            throw error("creating compound datatype for std::complex");
+        }
+        return type_id;
+    }
+};
+
+/**
+ * Fixed-size arrays as element type are mapped to HDF5 array types of rank 1.
+ * The type is created on first use and cached.
+ */
+template <typename T, std::size_t N>
+struct fixed_size_array_ctype
+{
+    static hid_t hid()
+    {
+        static hid_t const type_id = create();
+        return type_id;
+    }
+
+    static hid_t hid_copy()
+    {
+        return H5Tcopy(hid());
+    }
+
+private:
+    static hid_t create()
+    {
+        hsize_t dims[1] = { N };
+        hid_t type_id = H5Tarray_create(ctype<T>::hid(), 1, dims);
+        if (type_id < 0) {
+            throw error("creating array datatype");
+        }
+        return type_id;
+    }
+};
+
+template <typename T, std::size_t N>
+struct ctype<boost::array<T, N> >
+  : fixed_size_array_ctype<T, N> {};
+
+template <typename T, std::size_t N>
+struct ctype<std::array<T, N> >
+  : fixed_size_array_ctype<T, N> {};
+
+/**
+ * Trait to check whether a C/C++ type is mapped to an HDF5 native data type,
+ * i.e., whether ctype<T> is defined.
+ */
+template <typename T, typename Enable = void>
+struct has_ctype
+  : boost::false_type {};
+
+template <typename T>
+struct has_ctype<T, typename boost::enable_if_c<std::is_same<decltype(ctype<T>::hid()), hid_t>::value>::type>
+  : boost::true_type {};
+
+/**
+ * Create a new HDF5 data type for a member of a compound type, which must be
+ * closed by the caller. C arrays are mapped to HDF5 array types.
+ */
+template <typename T, typename Enable = void>
+struct compound_member
+{
+    static hid_t hid_copy()
+    {
+        return ctype<T>::hid_copy();
+    }
+};
+
+template <typename T>
+struct compound_member<T, typename boost::enable_if<std::is_array<T> >::type>
+{
+    static hid_t hid_copy()
+    {
+        typedef typename std::remove_all_extents<T>::type value_type;
+        enum { rank = std::rank<T>::value };
+        hsize_t dims[rank];
+        set_extents<T>(dims);
+        hid_t base_id = ctype<value_type>::hid();
+        return H5Tarray_create(base_id, rank, dims);
+    }
+
+private:
+    template <typename U>
+    static typename boost::enable_if_c<std::rank<U>::value == 0>::type set_extents(hsize_t*)
+    {}
+
+    template <typename U>
+    static typename boost::enable_if_c<(std::rank<U>::value > 0)>::type set_extents(hsize_t* dims)
+    {
+        *dims = std::extent<U>::value;
+        set_extents<typename std::remove_extent<U>::type>(dims + 1);
+    }
+};
+
 } // namespace detail
 } // namespace h5xx
 
+#define H5XX_COMPOUND_MEMBER(r, T, member)                                          \
+    {                                                                               \
+        hid_t member_id = h5xx::detail::compound_member<                            \
+            decltype(static_cast<T*>(0)->member)>::hid_copy();                      \
+        err |= member_id < 0;                                                       \
+        err |= H5Tinsert(type_id, BOOST_PP_STRINGIZE(member)                        \
+          , offsetof(T, member), member_id) < 0;                                    \
+        err |= H5Tclose(member_id) < 0;                                             \
+    }
+
+/**
+ * Declare an HDF5 compound data type for a C++ struct by listing its data
+ * members, e.g.,
+ *
+ *     struct particle { double pos[3]; double vel[3]; int id; char species; };
+ *     H5XX_COMPOUND(particle, pos, vel, id, species)
+ *
+ * The macro must be used in the global namespace with the fully qualified
+ * name of a standard-layout type. Members may be of fundamental type, of a
+ * previously declared compound type, or C arrays thereof; the compound fields
+ * are named after the members. The HDF5 type is created on first use and
+ * cached, it must not be closed.
+ */
+#define H5XX_COMPOUND(T, ...)                                                       \
+    namespace h5xx { namespace detail {                                             \
+    template <>                                                                     \
+    struct ctype<T>                                                                 \
+    {                                                                               \
+        static hid_t hid()                                                          \
+        {                                                                           \
+            static hid_t const type_id = create();                                  \
+            return type_id;                                                         \
+        }                                                                           \
+                                                                                    \
+        static hid_t hid_copy()                                                     \
+        {                                                                           \
+            return H5Tcopy(hid());                                                  \
+        }                                                                           \
+                                                                                    \
+    private:                                                                        \
+        static hid_t create()                                                       \
+        {                                                                           \
+            hid_t type_id = H5Tcreate(H5T_COMPOUND, sizeof(T));                     \
+            bool err = type_id < 0;                                                 \
+            BOOST_PP_SEQ_FOR_EACH(H5XX_COMPOUND_MEMBER, T                           \
+              , BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__))                              \
+            if (err) {                                                              \
+                throw h5xx::error("creating compound datatype for "                 \
+                    BOOST_PP_STRINGIZE(T));                                         \
+            }                                                                       \
+            return type_id;                                                         \
+        }                                                                           \
+    };                                                                              \
+    }} /* namespace h5xx::detail */
+
 #endif /* ! H5XX_CTYPE_HPP */
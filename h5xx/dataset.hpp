@@ -19,5 +19,10 @@
 #include <h5xx/dataset/std_vector.hpp>
 #include <h5xx/dataset/boost_array.hpp>
 #include <h5xx/dataset/boost_multi_array.hpp>
+#include <h5xx/dataset/compound.hpp>
+#include <h5xx/dataset/conversion.hpp>
+#include <h5xx/dataset/vlen.hpp>
+#include <h5xx/dataset/ragged.hpp>
+#include <h5xx/dataset/batch.hpp>
 
 #endif /* ! H5XX_DATASET_HPP */
@@ -0,0 +1,295 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_DATASET_BATCH_HPP
+#define H5XX_DATASET_BATCH_HPP
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <h5xx/ctype.hpp>
+#include <h5xx/dataset/dataset.hpp>
+#include <h5xx/dataspace.hpp>
+#include <h5xx/error.hpp>
+#include <h5xx/hdf5_compat.hpp>
+#include <h5xx/instrument.hpp>
+#include <h5xx/slice.hpp>
+#include <h5xx/utility.hpp>
+
+#include <boost/array.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/utility/enable_if.hpp>
+
+namespace h5xx {
+namespace detail {
+
+/**
+ * Access to the memory buffer of the containers supported by dataset_batch:
+ * element type, pointer to the data, and preparation for reading the whole
+ * dataset.
+ */
+template <typename T, typename Enable = void>
+struct batch_buffer;
+
+template <typename T>
+struct batch_buffer<T, typename boost::enable_if<boost::mpl::and_<is_vector<T>, has_ctype<typename T::value_type> > >::type>
+{
+    typedef typename T::value_type element_type;
+
+    static element_type* data(T& value) { return value.empty() ? NULL : &*value.begin(); }
+
+    static void resize(T& value, dataspace const& filespace)
+    {
+        value.clear();
+        value.resize(filespace.get_select_npoints());
+    }
+};
+
+template <typename T>
+struct batch_buffer<T, typename boost::enable_if<boost::mpl::and_<is_array<T>, has_ctype<typename T::value_type> > >::type>
+{
+    typedef typename T::value_type element_type;
+
+    static element_type* data(T& value) { return value.data(); }
+
+    static void resize(T& value, dataspace const& filespace)
+    {
+        if (static_cast<hsize_t>(filespace.get_select_npoints()) != value.size()) {
+            throw error("size of boost::array does not match dataspace");
+        }
+    }
+};
+
+template <typename T>
+struct batch_buffer<T, typename boost::enable_if<is_multi_array<T> >::type>
+{
+    typedef typename T::element element_type;
+
+    static element_type* data(T& value) { return value.origin(); }
+
+    static void resize(T& value, dataspace const& filespace)
+    {
+        enum { rank = T::dimensionality };
+        if (filespace.rank() != rank) {
+            throw error("dataspace and boost::multi_array have mismatching dimensions");
+        }
+        boost::array<hsize_t, rank> dims = filespace.extents<rank>();
+        boost::array<size_t, rank> shape;
+        std::copy(dims.begin(), dims.end(), shape.begin());
+        value.resize(shape);
+    }
+};
+
+} // namespace detail
+
+/**
+ * Collection of read and write operations on several datasets, which are
+ * issued together by execute().
+ *
+ * With HDF5 ≥ 1.14, all writes and all reads are passed each in a single
+ * call to H5Dwrite_multi and H5Dread_multi, respectively, which the MPI-IO
+ * driver turns into one collective operation. Otherwise, the operations are
+ * performed one after the other.
+ *
+ * The batch keeps the datasets open, but not the containers: these must
+ * neither be destroyed nor resized before execute() has returned. Whole
+ * datasets are read into std::vector and boost::multi_array containers,
+ * which are resized upon queuing; for slices, the containers must be large
+ * enough already, as for read_dataset().
+ */
+class dataset_batch
+{
+public:
+    dataset_batch() {}
+    ~dataset_batch() { clear(); }
+
+    /** queue writing the whole container to the dataset */
+    template <typename T>
+    void write(dataset& dset, T const& value)
+    {
+        push(writes_, dset, const_cast<T&>(value), H5S_ALL, H5S_ALL);
+    }
+
+    /** queue writing the whole container to a slice of the dataset */
+    template <typename T>
+    void write(dataset& dset, T const& value, slice const& file_slice)
+    {
+        dataspace filespace(dset);
+        filespace.select(file_slice);
+        push(writes_, dset, const_cast<T&>(value), H5Scopy(create_dataspace(value).hid()), H5Scopy(filespace.hid()));
+    }
+
+    /** queue reading the whole dataset into the container */
+    template <typename T>
+    void read(dataset& dset, T& value)
+    {
+        detail::batch_buffer<T>::resize(value, dataspace(dset));
+        push(reads_, dset, value, H5S_ALL, H5S_ALL);
+    }
+
+    /** queue reading a slice of the dataset into the container */
+    template <typename T>
+    void read(dataset& dset, T& value, slice const& file_slice)
+    {
+        dataspace filespace(dset);
+        filespace.select(file_slice);
+        push(reads_, dset, value, H5Scopy(create_dataspace(value).hid()), H5Scopy(filespace.hid()));
+    }
+
+    /** perform all queued writes, then all queued reads, and empty the batch */
+    void execute(hid_t xfer_plist_id = H5P_DEFAULT);
+
+    /** number of queued operations */
+    size_t size() const { return writes_.size() + reads_.size(); }
+
+    bool empty() const { return size() == 0; }
+
+    /** discard all queued operations */
+    void clear();
+
+private:
+    dataset_batch(dataset_batch const&) = delete;
+    dataset_batch& operator=(dataset_batch const&) = delete;
+
+    struct operation
+    {
+        hid_t dset_id;
+        hid_t type_id;
+        /** dataspaces owned by the batch, or H5S_ALL for the whole dataset */
+        hid_t mem_space_id;
+        hid_t file_space_id;
+        void* buffer;
+    };
+
+    /** append operation, takes ownership of the dataspace IDs */
+    template <typename T>
+    void push(std::vector<operation>& ops, dataset& dset, T& value, hid_t mem_space_id, hid_t file_space_id);
+
+    static void release(operation const& op);
+
+    /** pass list of operations to the HDF5 library, writing or reading */
+    static void transfer(std::vector<operation> const& ops, bool write, hid_t xfer_plist_id);
+
+    std::vector<operation> writes_;
+    std::vector<operation> reads_;
+};
+
+template <typename T>
+inline void dataset_batch::push(std::vector<operation>& ops, dataset& dset, T& value, hid_t mem_space_id, hid_t file_space_id)
+{
+    typedef typename detail::batch_buffer<T>::element_type element_type;
+    operation op;
+    op.dset_id = dset.hid();
+    op.type_id = ctype<element_type>::hid();
+    op.mem_space_id = mem_space_id;
+    op.file_space_id = file_space_id;
+    op.buffer = detail::batch_buffer<T>::data(value);
+    if (mem_space_id < 0 || file_space_id < 0 || H5Iinc_ref(op.dset_id) < 0) {
+        op.dset_id = -1;
+        release(op);
+        throw error("adding dataset \"" + get_name(dset) + "\" to batch");
+    }
+    ops.push_back(op);
+}
+
+inline void dataset_batch::transfer(std::vector<operation> const& ops, bool write, hid_t xfer_plist_id)
+{
+    if (ops.empty()) {
+        return;
+    }
+
+#if H5_VERSION_GE(1,14,0)
+    std::vector<hid_t> dset_ids, type_ids, mem_space_ids, file_space_ids;
+    std::vector<void*> buffers;
+    for (size_t i = 0; i < ops.size(); ++i) {
+        dset_ids.push_back(ops[i].dset_id);
+        type_ids.push_back(ops[i].type_id);
+        mem_space_ids.push_back(ops[i].mem_space_id);
+        file_space_ids.push_back(ops[i].file_space_id);
+        buffers.push_back(ops[i].buffer);
+    }
+    // the time of the joint transfer is split evenly between the datasets
+    std::vector<detail::instrument_probe> probes;
+    probes.reserve(ops.size());
+    for (size_t i = 0; i < ops.size(); ++i) {
+        probes.push_back(detail::instrument_probe(ops[i].dset_id, write, ops[i].type_id, ops[i].mem_space_id, ops[i].file_space_id));
+    }
+    herr_t retval;
+    if (write) {
+        std::vector<void const*> const_buffers(buffers.begin(), buffers.end());
+        retval = H5Dwrite_multi(ops.size(), &dset_ids[0], &type_ids[0], &mem_space_ids[0], &file_space_ids[0]
+          , xfer_plist_id, &const_buffers[0]);
+    }
+    else {
+        retval = H5Dread_multi(ops.size(), &dset_ids[0], &type_ids[0], &mem_space_ids[0], &file_space_ids[0]
+          , xfer_plist_id, &buffers[0]);
+    }
+    if (retval < 0) {
+        throw error(std::string(write ? "writing " : "reading ")
+          + boost::lexical_cast<std::string>(ops.size()) + " datasets in batch");
+    }
+    for (size_t i = 0; i < probes.size(); ++i) {
+        probes[i].done(probes.size());
+    }
+#else
+    for (size_t i = 0; i < ops.size(); ++i) {
+        operation const& op = ops[i];
+        detail::instrument_probe probe(op.dset_id, write, op.type_id, op.mem_space_id, op.file_space_id);
+        herr_t retval = write
+          ? H5Dwrite(op.dset_id, op.type_id, op.mem_space_id, op.file_space_id, xfer_plist_id, op.buffer)
+          : H5Dread(op.dset_id, op.type_id, op.mem_space_id, op.file_space_id, xfer_plist_id, op.buffer);
+        if (retval < 0) {
+            throw error(std::string(write ? "writing" : "reading") + " dataset \"" + get_name(op.dset_id) + "\" in batch");
+        }
+        probe.done();
+    }
+#endif
+}
+
+inline void dataset_batch::execute(hid_t xfer_plist_id)
+{
+    try {
+        transfer(writes_, true, xfer_plist_id);
+        transfer(reads_, false, xfer_plist_id);
+    }
+    catch (error const&) {
+        clear();
+        throw;
+    }
+    clear();
+}
+
+inline void dataset_batch::release(operation const& op)
+{
+    if (op.dset_id >= 0) {
+        H5Idec_ref(op.dset_id);
+    }
+    if (op.mem_space_id > 0 && op.mem_space_id != H5S_ALL) {
+        H5Sclose(op.mem_space_id);
+    }
+    if (op.file_space_id > 0 && op.file_space_id != H5S_ALL) {
+        H5Sclose(op.file_space_id);
+    }
+}
+
+inline void dataset_batch::clear()
+{
+    std::for_each(writes_.begin(), writes_.end(), &release);
+    std::for_each(reads_.begin(), reads_.end(), &release);
+    writes_.clear();
+    reads_.clear();
+}
+
+} // namespace h5xx
+
+#endif // ! H5XX_DATASET_BATCH_HPP
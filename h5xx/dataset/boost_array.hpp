@@ -33,10 +33,10 @@ namespace h5xx {
 
 
 /**
- * create dataset from a boost::array of fundamental type
+ * create dataset from a boost::array of fundamental or compound type
  **/
 template <typename h5xxObject, typename T, typename StoragePolicy>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, dataset>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, dataset>::type
 create_dataset(h5xxObject const& object, std::string const& name, T const& value,
                    StoragePolicy const& storage_policy = StoragePolicy())
 {
@@ -48,10 +48,10 @@ create_dataset(h5xxObject const& object, std::string const& name, T const& value
 }
 
 /**
- * create dataset from a boost::array of fundamental type, using default storage layout
+ * create dataset from a boost::array of fundamental or compound type, using default storage layout
  **/
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, dataset>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, dataset>::type
 create_dataset(h5xxObject const& object, std::string const& name, T const& value)
 {
     return create_dataset(object, name, value, h5xx::policy::storage::contiguous());
@@ -63,7 +63,7 @@ create_dataset(h5xxObject const& object, std::string const& name, T const& value
  * write boost::array data to an existing dataset specified by location and name
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(h5xxObject const& object, std::string const& name, T const& value)
 {
     dataset dset(object, name);
@@ -74,7 +74,7 @@ write_dataset(h5xxObject const& object, std::string const& name, T const& value)
  * write boost::array data to dataset
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(dataset& dset, T const& value)
 {
     typedef typename T::value_type value_type;
@@ -87,7 +87,7 @@ write_dataset(dataset& dset, T const& value)
  * memory and file locations (hyperslabs) are passed via the dataspace objects.
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(h5xxObject const& object, std::string const& name, T const& value,
                   dataspace const& memspace, dataspace const& filespace)
 {
@@ -100,7 +100,7 @@ write_dataset(h5xxObject const& object, std::string const& name, T const& value,
  * the dataspace objects.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(dataset& dset, T const& value, dataspace const& memspace, dataspace const& filespace)
 {
     typedef typename T::value_type value_type;
@@ -116,7 +116,7 @@ write_dataset(dataset& dset, T const& value, dataspace const& memspace, dataspac
  * name, only the file location (hyperslab) is given via a slice object.
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(h5xxObject const& object, std::string const& name, T const& value, slice const& file_slice)
 {
     dataset dset(object, name);
@@ -128,7 +128,7 @@ write_dataset(h5xxObject const& object, std::string const& name, T const& value,
  * (hyperslab) is given via a slice object.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(dataset& dset, T const& value, slice const& file_slice)
 {
     // --- create memory dataspace for the complete input array
@@ -145,7 +145,7 @@ write_dataset(dataset& dset, T const& value, slice const& file_slice)
  * Read boost::array data from an existing dataset specified by location and name.
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(h5xxObject const& object, std::string const& name, T & value)
 {
     dataset dset(object, name);
@@ -156,7 +156,7 @@ read_dataset(h5xxObject const& object, std::string const& name, T & value)
  * Read boost::array data from an existing dataset.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(dataset & data_set, T & value)
 {
     typedef typename T::value_type value_type;
@@ -180,7 +180,7 @@ read_dataset(dataset & data_set, T & value)
  * a slice specifies the data locations to be read in file space.
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(h5xxObject const& object, std::string const& name, T & value, slice const& file_slice)
 {
     dataset data_set(object, name);
@@ -192,7 +192,7 @@ read_dataset(h5xxObject const& object, std::string const& name, T & value, slice
  * locations to be read in file space.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(dataset & data_set, T & value, slice const& file_slice)
 {
     // --- create memory dataspace for the complete input array
@@ -209,7 +209,7 @@ read_dataset(dataset & data_set, T & value, slice const& file_slice)
  * memory and file allow to specify the locations of the data.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(dataset & data_set, T & value, dataspace const& memspace, dataspace const& filespace)
 {
     // Assure that the array has at least the capacity of the dataspace selection.
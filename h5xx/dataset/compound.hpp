@@ -0,0 +1,133 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_DATASET_COMPOUND_HPP
+#define H5XX_DATASET_COMPOUND_HPP
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <h5xx/ctype.hpp>
+#include <h5xx/dataset/dataset.hpp>
+#include <h5xx/dataspace.hpp>
+#include <h5xx/datatype/cache.hpp>
+#include <h5xx/error.hpp>
+#include <h5xx/slice.hpp>
+#include <h5xx/utility.hpp>
+
+#include <boost/utility/enable_if.hpp>
+
+namespace h5xx {
+namespace detail {
+
+/**
+ * Return a memory compound type that consists only of the member 'field' of
+ * the compound type of the dataset, converted to the C++ type T. The type is
+ * taken from the datatype cache, the returned ID must be released by the caller.
+ */
+template <typename T>
+inline hid_t create_field_type(dataset const& dset, std::string const& field)
+{
+    hid_t file_type_id = H5Dget_type(dset.hid());
+    bool found = file_type_id >= 0 && H5Tget_class(file_type_id) == H5T_COMPOUND
+        && H5Tget_member_index(file_type_id, field.c_str()) >= 0;
+    if (file_type_id >= 0) {
+        H5Tclose(file_type_id);
+    }
+    if (!found) {
+        throw error("dataset \"" + get_name(dset) + "\" has no compound member \"" + field + "\"");
+    }
+
+    return datatype_cache<std::pair<std::string, hid_t> >::instance().get(
+        std::make_pair(field, ctype<T>::hid()), [&field]() {
+            hid_t type_id = H5Tcreate(H5T_COMPOUND, sizeof(T));
+            if (type_id < 0 || H5Tinsert(type_id, field.c_str(), 0, ctype<T>::hid()) < 0) {
+                if (type_id >= 0) {
+                    H5Tclose(type_id);
+                }
+                throw error("creating memory type for compound member \"" + field + "\"");
+            }
+            return type_id;
+        }
+    );
+}
+
+} // namespace detail
+
+/**
+ * Read a single member (field) of a compound dataset into a contiguous
+ * std::vector, i.e., project an array of structures onto one of its
+ * columns. Only the requested member is transferred and converted by the
+ * HDF5 library. The vector is resized and overwritten internally.
+ */
+template <typename T, typename Alloc>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+read_field(dataset& dset, std::string const& field, std::vector<T, Alloc>& values)
+{
+    hid_t type_id = detail::create_field_type<T>(dset, field);
+
+    dataspace file_space(dset);
+    values.clear();
+    values.resize(file_space.get_select_npoints());
+    if (!values.empty()) {
+        try {
+            dset.read(type_id, &*values.begin());
+        }
+        catch (error const&) {
+            detail::release_type(type_id);
+            throw;
+        }
+    }
+    detail::release_type(type_id);
+}
+
+/**
+ * Read a single member of a compound dataset specified by location and name.
+ */
+template <typename h5xxObject, typename T, typename Alloc>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+read_field(h5xxObject const& object, std::string const& name, std::string const& field, std::vector<T, Alloc>& values)
+{
+    dataset dset(object, name);
+    read_field(dset, field, values);
+}
+
+/**
+ * Read a single member of a compound dataset, a slice specifies the data
+ * locations to be read in file space. The vector is resized to the number of
+ * selected elements.
+ */
+template <typename T, typename Alloc>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+read_field(dataset& dset, std::string const& field, std::vector<T, Alloc>& values, slice const& file_slice)
+{
+    hid_t type_id = detail::create_field_type<T>(dset, field);
+
+    dataspace filespace(dset);
+    filespace.select(file_slice);
+    values.clear();
+    values.resize(filespace.get_select_npoints());
+    if (!values.empty()) {
+        dataspace memspace = create_dataspace(values);
+        try {
+            dset.read(type_id, &*values.begin(), memspace.hid(), filespace.hid());
+        }
+        catch (error const&) {
+            detail::release_type(type_id);
+            throw;
+        }
+    }
+    detail::release_type(type_id);
+}
+
+} // namespace h5xx
+
+#endif // ! H5XX_DATASET_COMPOUND_HPP
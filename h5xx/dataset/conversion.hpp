@@ -0,0 +1,430 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_DATASET_CONVERSION_HPP
+#define H5XX_DATASET_CONVERSION_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <h5xx/allocator.hpp>
+#include <h5xx/ctype.hpp>
+#include <h5xx/dataset/dataset.hpp>
+#include <h5xx/dataspace.hpp>
+#include <h5xx/error.hpp>
+#include <h5xx/policy/conversion.hpp>
+#include <h5xx/utility.hpp>
+
+#include <boost/array.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/multi_array.hpp>
+#include <boost/type_traits.hpp>
+#include <boost/utility/enable_if.hpp>
+
+namespace h5xx {
+namespace detail {
+
+/** policy classes of namespace policy::conversion */
+template <typename T>
+struct is_conversion_policy
+  : boost::integral_constant<bool
+      , boost::is_same<T, policy::conversion::hdf5>::value
+     || boost::is_same<T, policy::conversion::strict>::value
+     || boost::is_same<T, policy::conversion::kernel>::value
+    > {};
+
+/** reverse the byte order, written such that compilers emit bswap instructions */
+inline boost::uint16_t byteswap(boost::uint16_t x)
+{
+    return static_cast<boost::uint16_t>((x >> 8) | (x << 8));
+}
+
+inline boost::uint32_t byteswap(boost::uint32_t x)
+{
+    return ((x & 0xffu) << 24) | ((x & 0xff00u) << 8) | ((x >> 8) & 0xff00u) | (x >> 24);
+}
+
+inline boost::uint64_t byteswap(boost::uint64_t x)
+{
+    return (boost::uint64_t(byteswap(boost::uint32_t(x))) << 32) | byteswap(boost::uint32_t(x >> 32));
+}
+
+template <size_t N> struct uint_of_size;
+template <> struct uint_of_size<1> { typedef boost::uint8_t type; };
+template <> struct uint_of_size<2> { typedef boost::uint16_t type; };
+template <> struct uint_of_size<4> { typedef boost::uint32_t type; };
+template <> struct uint_of_size<8> { typedef boost::uint64_t type; };
+
+inline boost::uint8_t byteswap(boost::uint8_t x) { return x; }
+
+/** reverse the byte order of a number of arbitrary type */
+template <typename T>
+inline T byteswap_value(T value)
+{
+    typename uint_of_size<sizeof(T)>::type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    bits = byteswap(bits);
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+/**
+ * Description of a numeric file type in terms of C++ types: class, size,
+ * signedness and whether the byte order differs from the native one. The
+ * class is H5T_NO_CLASS for types without a conversion kernel.
+ */
+struct raw_format
+{
+    H5T_class_t type_class;
+    size_t size;
+    bool is_signed;
+    bool swap;
+};
+
+inline raw_format get_raw_format(hid_t type_id)
+{
+    raw_format fmt = { H5Tget_class(type_id), H5Tget_size(type_id), false, false };
+
+    if (fmt.type_class == H5T_INTEGER) {
+        fmt.is_signed = H5Tget_sign(type_id) == H5T_SGN_2;
+        // no padding bits
+        if (H5Tget_precision(type_id) != 8 * fmt.size || H5Tget_offset(type_id) != 0) {
+            fmt.type_class = H5T_NO_CLASS;
+        }
+    }
+    else if (fmt.type_class == H5T_FLOAT) {
+        // IEEE single and double precision only
+        if (!(H5Tequal(type_id, H5T_IEEE_F32LE) > 0 || H5Tequal(type_id, H5T_IEEE_F32BE) > 0
+           || H5Tequal(type_id, H5T_IEEE_F64LE) > 0 || H5Tequal(type_id, H5T_IEEE_F64BE) > 0)) {
+            fmt.type_class = H5T_NO_CLASS;
+        }
+    }
+    else {
+        fmt.type_class = H5T_NO_CLASS;
+    }
+
+    H5T_order_t order = H5Tget_order(type_id);
+    if (fmt.size > 1 && order != H5T_ORDER_LE && order != H5T_ORDER_BE) {
+        fmt.type_class = H5T_NO_CLASS;
+    }
+    fmt.swap = fmt.size > 1 && order != H5Tget_order(H5T_NATIVE_INT);
+    return fmt;
+}
+
+/** conversion of a single number, plain cast for floating-point types */
+template <typename Dst, typename Src, typename Enable = void>
+struct number_cast
+{
+    static Dst apply(Src value) { return static_cast<Dst>(value); }
+};
+
+/**
+ * integer conversion saturates at the limits of Dst, as the HDF5 library
+ * does for out-of-range values
+ */
+template <typename Dst, typename Src>
+struct number_cast<Dst, Src, typename boost::enable_if_c<
+    boost::is_integral<Src>::value && boost::is_integral<Dst>::value && !boost::is_same<Src, Dst>::value
+>::type>
+{
+    static Dst apply(Src value)
+    {
+        return apply(value, boost::is_signed<Src>());
+    }
+
+private:
+    static Dst apply(Src value, boost::true_type)
+    {
+        boost::intmax_t v = value;
+        if (v < 0) {
+            return static_cast<Dst>(std::max(v, boost::intmax_t(std::numeric_limits<Dst>::min())));
+        }
+        return static_cast<Dst>(std::min(boost::uintmax_t(v), boost::uintmax_t(std::numeric_limits<Dst>::max())));
+    }
+
+    static Dst apply(Src value, boost::false_type)
+    {
+        return static_cast<Dst>(std::min(boost::uintmax_t(value), boost::uintmax_t(std::numeric_limits<Dst>::max())));
+    }
+};
+
+/**
+ * Convert n numbers of type Src, optionally byte-swapped, to type Dst. The
+ * loops have no dependencies and are vectorised by the compiler. For Src ==
+ * Dst, src and dst may point to the same memory.
+ */
+template <typename Src, typename Dst>
+inline void convert_numbers(void const* src, Dst* dst, size_t n, bool swap)
+{
+    Src const* s = static_cast<Src const*>(src);
+    if (swap) {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = number_cast<Dst, Src>::apply(byteswap_value(s[i]));
+        }
+    }
+    else {
+        for (size_t i = 0; i < n; ++i) {
+            dst[i] = number_cast<Dst, Src>::apply(s[i]);
+        }
+    }
+}
+
+/** conversion kernel from a raw file buffer to the memory type Dst */
+template <typename Dst>
+struct conversion_kernel
+{
+    void (*convert)(void const* src, Dst* dst, size_t n, bool swap);
+    /** the raw data may be converted within the destination buffer */
+    bool in_place;
+};
+
+template <typename Src, typename Dst>
+inline conversion_kernel<Dst> make_kernel()
+{
+    conversion_kernel<Dst> kernel = { &convert_numbers<Src, Dst>, boost::is_same<Src, Dst>::value };
+    return kernel;
+}
+
+/** select kernel for integer source type of given size */
+template <typename Dst, typename Signed, typename Unsigned>
+inline conversion_kernel<Dst> make_integer_kernel(bool is_signed)
+{
+    return is_signed ? make_kernel<Signed, Dst>() : make_kernel<Unsigned, Dst>();
+}
+
+/**
+ * Select the conversion kernel from the file format to Dst, returns a kernel
+ * with convert == NULL if h5xx provides none. Kernels exist between IEEE
+ * floating-point types and between integer types of any size and
+ * signedness, both with either byte order.
+ */
+template <typename Dst>
+inline conversion_kernel<Dst> select_kernel(raw_format const& fmt)
+{
+    conversion_kernel<Dst> none = { NULL, false };
+
+    if (fmt.type_class == H5T_FLOAT && boost::is_floating_point<Dst>::value) {
+        switch (fmt.size) {
+          case sizeof(float):
+            return make_kernel<float, Dst>();
+          case sizeof(double):
+            return make_kernel<double, Dst>();
+        }
+    }
+    // bool is stored as char by h5xx
+    if (fmt.type_class == H5T_INTEGER && boost::is_integral<Dst>::value && !boost::is_same<Dst, bool>::value) {
+        switch (fmt.size) {
+          case 1:
+            return make_integer_kernel<Dst, boost::int8_t, boost::uint8_t>(fmt.is_signed);
+          case 2:
+            return make_integer_kernel<Dst, boost::int16_t, boost::uint16_t>(fmt.is_signed);
+          case 4:
+            return make_integer_kernel<Dst, boost::int32_t, boost::uint32_t>(fmt.is_signed);
+          case 8:
+            return make_integer_kernel<Dst, boost::int64_t, boost::uint64_t>(fmt.is_signed);
+        }
+    }
+    return none;
+}
+
+/** size in bytes of the staging buffers for raw data */
+enum {
+    /** blocks converted from cache */
+    conversion_block_size = 1 << 16
+    /** blocks read from file for narrowing conversions */
+  , conversion_staging_size = 1 << 22
+};
+
+/**
+ * Convert n raw elements of the file type, stored at the beginning of the
+ * destination buffer, to a wider or equally sized type Dst. Blocks are
+ * copied to a scratch buffer and converted back to front, so that no raw
+ * data is overwritten before it is read. The scratch buffer is obtained
+ * from the allocator Alloc of the destination (see detail::raw_buffer).
+ */
+template <typename Alloc, typename Dst>
+inline void convert_widening(conversion_kernel<Dst> const& kernel, raw_format const& fmt, Dst* buffer, size_t n)
+{
+    size_t block = std::max<size_t>(conversion_block_size / fmt.size, 1);
+    raw_buffer<Alloc> scratch(block * fmt.size);
+    char const* raw = reinterpret_cast<char const*>(buffer);
+    for (size_t end = n; end > 0; ) {
+        size_t begin = end > block ? end - block : 0;
+        std::memcpy(scratch.data(), raw + begin * fmt.size, (end - begin) * fmt.size);
+        kernel.convert(scratch.data(), buffer + begin, end - begin, fmt.swap);
+        end = begin;
+    }
+}
+
+/**
+ * Read the dataset in slabs along the slowest dimension into a staging
+ * buffer from the allocator Alloc and convert each slab to the narrower
+ * type Dst.
+ */
+template <typename Alloc, typename Dst>
+inline void read_narrowing(dataset& dset, hid_t file_type_id, conversion_kernel<Dst> const& kernel, raw_format const& fmt, Dst* buffer, size_t n)
+{
+    dataspace filespace(dset);
+    std::vector<hsize_t> dims = filespace.extents();
+    if (dims.empty()) {
+        // scalar dataspace
+        raw_buffer<Alloc> staging(fmt.size);
+        dset.read(file_type_id, staging.data());
+        kernel.convert(staging.data(), buffer, 1, fmt.swap);
+        return;
+    }
+
+    size_t row = n / dims[0];
+    hsize_t rows = std::max<hsize_t>(conversion_staging_size / (row * fmt.size), 1);
+    raw_buffer<Alloc> staging(rows * row * fmt.size);
+    std::vector<hsize_t> offset(dims.size(), 0), count(dims);
+    for (hsize_t first = 0; first < dims[0]; first += rows) {
+        offset[0] = first;
+        count[0] = std::min(rows, dims[0] - first);
+        if (H5Sselect_hyperslab(filespace.hid(), H5S_SELECT_SET, &*offset.begin(), NULL, &*count.begin(), NULL) < 0) {
+            throw error("selecting hyperslab of dataset \"" + get_name(dset) + "\"");
+        }
+        size_t size = count[0] * row;
+        dataspace memspace(std::vector<hsize_t>(1, size));
+        dset.read(file_type_id, staging.data(), memspace.hid(), filespace.hid());
+        kernel.convert(staging.data(), buffer + first * row, size, fmt.swap);
+    }
+}
+
+/** read the whole dataset into a buffer of n elements, conversion by HDF5 */
+template <typename Alloc, typename T>
+inline void read_buffer(dataset& dset, T* buffer, size_t, policy::conversion::hdf5)
+{
+    dset.read(ctype<T>::hid(), buffer);
+}
+
+/** read the whole dataset into a buffer of n elements, the types must match */
+template <typename Alloc, typename T>
+inline void read_buffer(dataset& dset, T* buffer, size_t, policy::conversion::strict)
+{
+    hid_t file_type_id = dset.get_type();
+    bool equal = H5Tequal(file_type_id, ctype<T>::hid()) > 0;
+    H5Tclose(file_type_id);
+    if (!equal) {
+        throw error("reading dataset \"" + get_name(dset) + "\" requires a conversion of its datatype");
+    }
+    dset.read(ctype<T>::hid(), buffer);
+}
+
+/**
+ * read the whole dataset into a buffer of n elements, conversion by h5xx
+ * kernels if available and by HDF5 otherwise; the raw data are read into
+ * the destination buffer if it is large enough and into a staging buffer
+ * from the allocator Alloc of the destination otherwise
+ */
+template <typename Alloc, typename T>
+inline void read_buffer(dataset& dset, T* buffer, size_t n, policy::conversion::kernel)
+{
+    hid_t file_type_id = dset.get_type();
+    conversion_kernel<T> kernel = { NULL, false };
+    raw_format fmt = get_raw_format(file_type_id);
+    if (H5Tequal(file_type_id, ctype<T>::hid()) <= 0) {
+        kernel = select_kernel<T>(fmt);
+    }
+
+    try {
+        if (!kernel.convert) {
+            dset.read(ctype<T>::hid(), buffer);
+        }
+        else if (kernel.in_place) {
+            // reading with the file type as memory type bypasses the HDF5 conversion
+            dset.read(file_type_id, buffer);
+            kernel.convert(buffer, buffer, n, fmt.swap);
+        }
+        else if (fmt.size <= sizeof(T)) {
+            dset.read(file_type_id, buffer);
+            convert_widening<Alloc>(kernel, fmt, buffer, n);
+        }
+        else {
+            read_narrowing<Alloc>(dset, file_type_id, kernel, fmt, buffer, n);
+        }
+    }
+    catch (...) {
+        H5Tclose(file_type_id);
+        throw;
+    }
+    H5Tclose(file_type_id);
+}
+
+} // namespace detail
+
+/**
+ * Return true if reading the dataset into memory of type T requires a
+ * conversion of the datatype, e.g., from double to float or from big-endian
+ * to little-endian byte order.
+ */
+template <typename T>
+inline bool requires_conversion(dataset const& dset)
+{
+    hid_t file_type_id = dset.get_type();
+    bool equal = H5Tequal(file_type_id, ctype<T>::hid()) > 0;
+    H5Tclose(file_type_id);
+    return !equal;
+}
+
+/**
+ * Read std::vector data from an existing dataset, the conversion policy
+ * selects how the file type is converted to the memory type. The vector data
+ * is resized and overwritten internally.
+ */
+template <typename T, typename Alloc, typename ConversionPolicy>
+inline typename boost::enable_if<boost::mpl::and_<boost::is_arithmetic<T>, detail::is_conversion_policy<ConversionPolicy> >, void>::type
+read_dataset(dataset& dset, std::vector<T, Alloc>& value, ConversionPolicy conversion_policy)
+{
+    size_t size = dataspace(dset).get_select_npoints();
+    value.clear();
+    value.resize(size);
+    if (size > 0) {
+        detail::read_buffer<Alloc>(dset, &*value.begin(), size, conversion_policy);
+    }
+}
+
+template <typename h5xxObject, typename T, typename Alloc, typename ConversionPolicy>
+inline typename boost::enable_if<boost::mpl::and_<boost::is_arithmetic<T>, detail::is_conversion_policy<ConversionPolicy> >, void>::type
+read_dataset(h5xxObject const& object, std::string const& name, std::vector<T, Alloc>& value, ConversionPolicy conversion_policy)
+{
+    dataset dset(object, name);
+    read_dataset(dset, value, conversion_policy);
+}
+
+/**
+ * Read multi-array data from an existing dataset, the conversion policy
+ * selects how the file type is converted to the memory type. The array is
+ * resized to the shape of the dataset.
+ */
+template <typename T, size_t N, typename Alloc, typename ConversionPolicy>
+inline typename boost::enable_if<boost::mpl::and_<boost::is_arithmetic<T>, detail::is_conversion_policy<ConversionPolicy> >, void>::type
+read_dataset(dataset& dset, boost::multi_array<T, N, Alloc>& array, ConversionPolicy conversion_policy)
+{
+    dataspace file_space(dset);
+    if (file_space.rank() != N) {
+        throw error("dataset \"" + get_name(dset) + "\" and target array have mismatching dimensions");
+    }
+    boost::array<hsize_t, N> dims = file_space.extents<N>();
+    boost::array<size_t, N> shape;
+    std::copy(dims.begin(), dims.end(), shape.begin());
+    array.resize(shape);
+    if (array.num_elements() > 0) {
+        detail::read_buffer<Alloc>(dset, array.origin(), array.num_elements(), conversion_policy);
+    }
+}
+
+} // namespace h5xx
+
+#endif // ! H5XX_DATASET_CONVERSION_HPP
@@ -15,6 +15,7 @@
 #include <h5xx/dataset/utility.hpp>
 #include <h5xx/dataspace.hpp>
 #include <h5xx/datatype.hpp>
+#include <h5xx/instrument.hpp>
 #include <h5xx/policy/storage.hpp>
 
 namespace h5xx {
@@ -78,6 +79,19 @@ public:
     /** return copy of dataset's type */
     hid_t get_type() const;
 
+    /**
+     * change the extents of a chunked dataset within its maximal dimensions,
+     * also permitted for a file in SWMR write mode; the number of extents
+     * must match the rank of the dataset
+     */
+    void set_extent(std::vector<hsize_t> const& dims);
+
+    /** flush all buffers associated with the dataset, making them visible to SWMR readers */
+    void flush();
+
+    /** refresh the dataset's metadata to observe changes by a SWMR writer */
+    void refresh();
+
 private:
     /** HDF5 handle of the dataset */
     hid_t hid_;
@@ -90,13 +104,12 @@ template <typename h5xxObject>
 dataset::dataset(h5xxObject const& object, std::string const& name, hid_t dapl_id)
   : hid_(-1)
 {
-    if (h5xx::exists_dataset(object, name))
-    {
+    H5E_BEGIN_TRY {
         hid_ = H5Dopen(object.hid(), name.c_str(), dapl_id);
-    }
+    } H5E_END_TRY
     if (hid_ < 0)
     {
-        throw error("opening dataset \"" + name + "\" at HDF5 object \"" + get_name(object) + "\"");
+        throw error(status(status::failure, "opening dataset", name, object.hid()));
     }
 }
 
@@ -148,10 +161,9 @@ dataset::dataset(
 
 inline dataset::~dataset()
 {
+    // destructors must not throw, a failure cannot be reported
     if (hid_ >= 0) {
-        if(H5Dclose(hid_) < 0){
-            throw error("closing h5xx::dataset with ID " + boost::lexical_cast<std::string>(hid_));
-        }
+        H5Dclose(hid_);
         hid_ = -1;
     }
 }
@@ -185,18 +197,22 @@ inline dataset::operator dataspace() const
 
 inline void dataset::write(hid_t type_id, void const* value, hid_t mem_space_id, hid_t file_space_id, hid_t xfer_plist_id)
 {
+    detail::instrument_probe probe(hid_, true, type_id, mem_space_id, file_space_id);
     if (H5Dwrite(hid_, type_id, mem_space_id, file_space_id, xfer_plist_id, value) < 0)
     {
         throw error("writing dataset");
     }
+    probe.done();
 }
 
 inline void dataset::read(hid_t type_id, void * buffer, hid_t mem_space_id, hid_t file_space_id, hid_t xfer_plist_id)
 {
+    detail::instrument_probe probe(hid_, false, type_id, mem_space_id, file_space_id);
     if (H5Dread(hid_, type_id, mem_space_id, file_space_id, xfer_plist_id, buffer) < 0)
     {
         throw error("reading dataset");
     }
+    probe.done();
 }
 
 inline hid_t dataset::get_type() const
@@ -209,6 +225,41 @@ inline hid_t dataset::get_type() const
     return type_id;
 }
 
+inline void dataset::set_extent(std::vector<hsize_t> const& dims)
+{
+    if (dims.size() != dataspace(*this).rank()) {
+        throw error("rank of new extents does not match dataset \"" + get_name(*this) + "\"");
+    }
+    if (H5Dset_extent(hid_, &*dims.begin()) < 0)
+    {
+        throw error("changing extents of dataset \"" + get_name(*this) + "\"");
+    }
+}
+
+inline void dataset::flush()
+{
+#if H5_VERSION_GE(1,10,0)
+    if (H5Dflush(hid_) < 0)
+#else
+    if (H5Fflush(hid_, H5F_SCOPE_LOCAL) < 0)
+#endif
+    {
+        throw error("flushing dataset \"" + get_name(*this) + "\"");
+    }
+}
+
+inline void dataset::refresh()
+{
+#if H5_VERSION_GE(1,10,0)
+    if (H5Drefresh(hid_) < 0)
+    {
+        throw error("refreshing dataset \"" + get_name(*this) + "\"");
+    }
+#else
+    throw error("refreshing datasets requires HDF5 ≥ 1.10");
+#endif
+}
+
 inline hid_t dataset::hid() const
 {
     return hid_;
@@ -0,0 +1,308 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_DATASET_RAGGED_HPP
+#define H5XX_DATASET_RAGGED_HPP
+
+#include <string>
+#include <vector>
+
+#include <h5xx/ctype.hpp>
+#include <h5xx/dataset/dataset.hpp>
+#include <h5xx/dataset/std_vector.hpp>
+#include <h5xx/dataset/vlen.hpp>
+#include <h5xx/dataspace.hpp>
+#include <h5xx/datatype/cache.hpp>
+#include <h5xx/error.hpp>
+#include <h5xx/policy/ragged.hpp>
+#include <h5xx/policy/storage.hpp>
+#include <h5xx/slice.hpp>
+#include <h5xx/utility.hpp>
+
+#include <boost/utility/enable_if.hpp>
+
+namespace h5xx {
+
+/**
+ * create dataset of variable-length sequences from a ragged array, i.e., a
+ * std::vector of rows of different length
+ */
+template <typename h5xxObject, typename T, typename StoragePolicy>
+inline typename boost::enable_if<detail::has_ctype<T>, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> > const& value
+  , StoragePolicy const& storage_policy)
+{
+    hid_t type_id = detail::cached_vlen_type(ctype<T>::hid());
+    std::vector<hsize_t> dims(1, value.size());
+    dataset dset;
+    try {
+        dset = dataset(object, name, type_id, dataspace(dims), storage_policy);
+    }
+    catch (error const&) {
+        detail::release_type(type_id);
+        throw;
+    }
+    detail::release_type(type_id);
+    return dset;
+}
+
+/**
+ * create dataset of variable-length sequences from a ragged array, using
+ * default storage layout
+ */
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> > const& value)
+{
+    return create_dataset(object, name, value, policy::storage::contiguous());
+}
+
+/**
+ * write ragged array to a dataset of variable-length sequences, the rows
+ * are passed to the HDF5 library without copying
+ */
+template <typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+write_dataset(dataset& dset, std::vector<std::vector<T> > const& value)
+{
+    if (static_cast<hsize_t>(dataspace(dset).get_select_npoints()) != value.size()) {
+        throw error("size of vector does not match dataspace of dataset \"" + get_name(dset) + "\"");
+    }
+    if (value.empty()) {
+        return;
+    }
+
+    std::vector<hvl_t> buffer(value.size());
+    for (size_t i = 0; i < value.size(); ++i) {
+        buffer[i].len = value[i].size();
+        buffer[i].p = value[i].empty() ? NULL : const_cast<T*>(&*value[i].begin());
+    }
+    hid_t type_id = detail::cached_vlen_type(ctype<T>::hid());
+    try {
+        dset.write(type_id, &*buffer.begin());
+    }
+    catch (error const&) {
+        detail::release_type(type_id);
+        throw;
+    }
+    detail::release_type(type_id);
+}
+
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+write_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> > const& value)
+{
+    dataset dset(object, name);
+    write_dataset(dset, value);
+}
+
+/**
+ * Read ragged array from a dataset of variable-length sequences. The vector
+ * is resized and overwritten internally. The HDF5 library allocates the
+ * rows from a temporary vlen_arena instead of calling malloc for each row.
+ */
+template <typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+read_dataset(dataset& dset, std::vector<std::vector<T> >& value)
+{
+    vlen_arena arena;
+    std::vector<boost::iterator_range<T const*> > rows;
+    read_dataset(dset, rows, arena);
+
+    value.resize(rows.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        value[i].assign(rows[i].begin(), rows[i].end());
+    }
+}
+
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+read_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> >& value)
+{
+    dataset dset(object, name);
+    read_dataset(dset, value);
+}
+
+/**
+ * create dataset of variable-length sequences from a ragged array, the
+ * layout policy::ragged::vlen is the default
+ */
+template <typename h5xxObject, typename T, typename StoragePolicy>
+inline typename boost::enable_if<detail::has_ctype<T>, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> > const& value
+  , policy::ragged::vlen, StoragePolicy const& storage_policy)
+{
+    return create_dataset(object, name, value, storage_policy);
+}
+
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> > const& value
+  , policy::ragged::vlen)
+{
+    return create_dataset(object, name, value);
+}
+
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+write_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> > const& value
+  , policy::ragged::vlen)
+{
+    write_dataset(object, name, value);
+}
+
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+read_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> >& value
+  , policy::ragged::vlen)
+{
+    read_dataset(object, name, value);
+}
+
+namespace detail {
+
+/** number of rows of a ragged array, the dataset "offsets" holds one more entry */
+inline hsize_t ragged_rows(dataset const& offsets_dset, std::string const& name)
+{
+    hssize_t npoints = dataspace(offsets_dset).get_select_npoints();
+    if (npoints < 1) {
+        throw error("empty offsets of ragged array in group \"" + name + "\"");
+    }
+    return npoints - 1;
+}
+
+} // namespace detail
+
+/**
+ * Create the datasets "offsets" and "values" of a ragged array in the group
+ * 'name', which is created as well. The storage policy applies to the values.
+ */
+template <typename h5xxObject, typename T, typename StoragePolicy>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+create_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> > const& value
+  , policy::ragged::offsets, StoragePolicy const& storage_policy)
+{
+    hsize_t nvalues = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+        nvalues += value[i].size();
+    }
+
+    hid_t lcpl_id = H5Pcreate(H5P_LINK_CREATE);     // creates the group
+    try {
+        dataset(object, name + "/offsets", ctype<unsigned long long>::hid()
+          , dataspace(std::vector<hsize_t>(1, value.size() + 1)), policy::storage::contiguous(), lcpl_id);
+        dataset(object, name + "/values", ctype<T>::hid()
+          , dataspace(std::vector<hsize_t>(1, nvalues)), storage_policy);
+    }
+    catch (error const&) {
+        H5Pclose(lcpl_id);
+        throw;
+    }
+    H5Pclose(lcpl_id);
+}
+
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+create_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> > const& value
+  , policy::ragged::offsets layout)
+{
+    create_dataset(object, name, value, layout, policy::storage::contiguous());
+}
+
+/**
+ * Write ragged array to the datasets "offsets" and "values" in group 'name'.
+ * The number of rows and the total number of values must match the
+ * datasets.
+ */
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+write_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> > const& value
+  , policy::ragged::offsets)
+{
+    std::vector<unsigned long long> offsets(1, 0);
+    offsets.reserve(value.size() + 1);
+    for (size_t i = 0; i < value.size(); ++i) {
+        offsets.push_back(offsets.back() + value[i].size());
+    }
+    std::vector<T> values;
+    values.reserve(offsets.back());
+    for (size_t i = 0; i < value.size(); ++i) {
+        values.insert(values.end(), value[i].begin(), value[i].end());
+    }
+
+    dataset offsets_dset(object, name + "/offsets");
+    dataset values_dset(object, name + "/values");
+    if (static_cast<hsize_t>(dataspace(offsets_dset).get_select_npoints()) != offsets.size()
+        || static_cast<hsize_t>(dataspace(values_dset).get_select_npoints()) != values.size()) {
+        throw error("shape of ragged array does not match datasets in group \"" + name + "\"");
+    }
+    write_dataset(offsets_dset, offsets);
+    if (!values.empty()) {
+        write_dataset(values_dset, values);
+    }
+}
+
+/**
+ * Read rows [first, first + count) of a ragged array stored in the datasets
+ * "offsets" and "values" of group 'name'. Only the requested values are
+ * transferred. The vector is resized and overwritten internally.
+ */
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+read_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> >& value
+  , policy::ragged::offsets, hsize_t first, hsize_t count)
+{
+    dataset offsets_dset(object, name + "/offsets");
+    dataset values_dset(object, name + "/values");
+    hsize_t nrows = detail::ragged_rows(offsets_dset, name);
+    if (first + count > nrows) {
+        throw error("rows exceed ragged array in group \"" + name + "\"");
+    }
+
+    std::vector<unsigned long long> offsets(count + 1);
+    read_dataset(offsets_dset, offsets, slice(std::vector<hsize_t>(1, first), std::vector<hsize_t>(1, count + 1)));
+    hsize_t nvalues = offsets.back() - offsets.front();
+    if (offsets.back() < offsets.front()
+        || offsets.back() > static_cast<hsize_t>(dataspace(values_dset).get_select_npoints())) {
+        throw error("invalid offsets of ragged array in group \"" + name + "\"");
+    }
+
+    std::vector<T> values(nvalues);
+    if (nvalues > 0) {
+        read_dataset(values_dset, values, slice(std::vector<hsize_t>(1, offsets.front()), std::vector<hsize_t>(1, nvalues)));
+    }
+
+    value.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (offsets[i + 1] < offsets[i]) {
+            throw error("invalid offsets of ragged array in group \"" + name + "\"");
+        }
+        value[i].assign(values.begin() + (offsets[i] - offsets.front()), values.begin() + (offsets[i + 1] - offsets.front()));
+    }
+}
+
+/**
+ * Read the complete ragged array stored in the datasets "offsets" and
+ * "values" of group 'name'. The vector is resized and overwritten
+ * internally.
+ */
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+read_dataset(h5xxObject const& object, std::string const& name, std::vector<std::vector<T> >& value
+  , policy::ragged::offsets layout)
+{
+    dataset offsets_dset(object, name + "/offsets");
+    hsize_t nrows = detail::ragged_rows(offsets_dset, name);
+    read_dataset(object, name, value, layout, 0, nrows);
+}
+
+} // namespace h5xx
+
+#endif // ! H5XX_DATASET_RAGGED_HPP
@@ -16,7 +16,9 @@
 #include <h5xx/ctype.hpp>
 #include <h5xx/dataset/dataset.hpp>
 #include <h5xx/dataset/utility.hpp>
+#include <h5xx/dataset/vlen.hpp>
 #include <h5xx/dataspace.hpp>
+#include <h5xx/datatype/cache.hpp>
 #include <h5xx/error.hpp>
 #include <h5xx/policy/string.hpp>
 #include <h5xx/policy/storage.hpp>
@@ -27,6 +29,10 @@
 #include <boost/type_traits.hpp>
 #include <boost/utility/enable_if.hpp>
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 namespace h5xx {
 
 /**
@@ -94,7 +100,140 @@ read_dataset(h5xxObject const& object, std::string const& name)
     return value;
 }
 
-// TODO : implement string support in analogy to attribute
+/**
+ * create scalar dataset for a std::string at h5xx object, the string policy
+ * determines the datatype; the length of a fixed-size string type is taken
+ * from the given value
+ */
+template <typename h5xxObject, typename T, typename StringPolicy, typename StoragePolicy>
+inline typename boost::enable_if<boost::is_same<T, std::string>, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, T const& value
+  , StringPolicy string_policy, StoragePolicy const& storage_policy)
+{
+    hid_t type_id = string_policy.cached_type(std::max<size_t>(value.size(), 1));
+    dataset dset;
+    try {
+        dset = dataset(object, name, type_id, dataspace(H5S_SCALAR), storage_policy);
+    }
+    catch (error const&) {
+        detail::release_type(type_id);
+        throw;
+    }
+    detail::release_type(type_id);
+    return dset;
+}
+
+/**
+ * create scalar dataset for a std::string, using compact storage
+ */
+template <typename h5xxObject, typename T, typename StringPolicy>
+inline typename boost::enable_if<boost::is_same<T, std::string>, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, T const& value, StringPolicy string_policy)
+{
+    return create_dataset(object, name, value, string_policy, policy::storage::compact());
+}
+
+/**
+ * create scalar dataset for a null-terminated std::string, using compact storage
+ */
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<boost::is_same<T, std::string>, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, T const& value)
+{
+    return create_dataset(object, name, value, policy::string::null_terminated(), policy::storage::compact());
+}
+
+/**
+ * write std::string to scalar dataset of fixed-size or variable-length string
+ * type; fixed-size strings are truncated to the size of the datatype
+ */
+template <typename T>
+inline typename boost::enable_if<boost::is_same<T, std::string>, void>::type
+write_dataset(dataset& dset, T const& value)
+{
+    if (!dataspace(dset).is_scalar()) {
+        throw error("dataset \"" + get_name(dset) + "\" has non-scalar dataspace");
+    }
+
+    hid_t file_type_id = dset.get_type();
+    bool is_string = H5Tget_class(file_type_id) == H5T_STRING;
+    hid_t type_id = is_string ? detail::cached_string_mem_type(file_type_id) : -1;
+    H5Tclose(file_type_id);
+    if (!is_string) {
+        throw error("dataset \"" + get_name(dset) + "\" is not of string type");
+    }
+    bool is_varlen_str = H5Tis_variable_str(type_id) > 0;
+    size_t str_size = H5Tget_size(type_id);
+
+    if (is_varlen_str) {
+        char const* p = value.c_str();
+        dset.write(type_id, &p);
+        detail::release_type(type_id);
+    }
+    else {
+        std::vector<char> buffer(str_size, '\0');
+        value.copy(&*buffer.begin(), str_size);
+        dset.write(type_id, &*buffer.begin());
+        detail::release_type(type_id);
+    }
+}
+
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if<boost::is_same<T, std::string>, void>::type
+write_dataset(h5xxObject const& object, std::string const& name, T const& value)
+{
+    dataset dset(object, name);
+    write_dataset(dset, value);
+}
+
+/**
+ * read std::string from scalar dataset of fixed-size or variable-length string type
+ */
+template <typename T>
+inline typename boost::enable_if<boost::is_same<T, std::string>, T>::type
+read_dataset(dataset& dset)
+{
+    dataspace space(dset);
+    if (!space.is_scalar()) {
+        throw error("dataset \"" + get_name(dset) + "\" has non-scalar dataspace");
+    }
+
+    hid_t file_type_id = dset.get_type();
+    bool is_string = H5Tget_class(file_type_id) == H5T_STRING;
+    hid_t type_id = is_string ? detail::cached_string_mem_type(file_type_id) : -1;
+    H5Tclose(file_type_id);
+    if (!is_string) {
+        throw error("dataset \"" + get_name(dset) + "\" is not of string type");
+    }
+    detail::cached_type_ref type(type_id);
+    bool is_varlen_str = H5Tis_variable_str(type_id) > 0;
+    size_t str_size = H5Tget_size(type_id);
+
+    std::string value;
+    if (is_varlen_str) {
+        // the HDF5 library allocates the string from the arena, released on return
+        vlen_arena arena(256);
+        char* c_str = NULL;
+        detail::read_vlen(dset, type_id, &c_str, arena);
+        if (c_str) {
+            value = c_str;
+        }
+    }
+    else {
+        std::vector<char> buffer(str_size);
+        dset.read(type_id, &*buffer.begin());
+        value.assign(buffer.begin(), std::find(buffer.begin(), buffer.end(), '\0'));
+    }
+    return value;
+}
+
+template <typename T, typename h5xxObject>
+inline typename boost::enable_if<boost::is_same<T, std::string>, T>::type
+read_dataset(h5xxObject const& object, std::string const& name)
+{
+    dataset dset(object, name);
+    return read_dataset<T>(dset);
+}
 
 } // namespace h5xx
 
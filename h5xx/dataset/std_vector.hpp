@@ -14,12 +14,16 @@
 #define H5XX_DATASET_STD_VECTOR
 
 #include <algorithm>
+#include <string>
 #include <vector>
 
 #include <h5xx/ctype.hpp>
 #include <h5xx/dataset/dataset.hpp>
+#include <h5xx/dataset/vlen.hpp>
 #include <h5xx/dataspace.hpp>
+#include <h5xx/datatype/cache.hpp>
 #include <h5xx/policy/storage.hpp>
+#include <h5xx/policy/string.hpp>
 #include <h5xx/utility.hpp>
 #include <h5xx/error.hpp>
 
@@ -33,10 +37,10 @@ namespace h5xx {
 
 
 /**
- * create dataset from a std::vector of fundamental type
+ * create dataset from a std::vector of fundamental or compound type
  **/
 template <typename h5xxObject, typename T, typename StoragePolicy>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, dataset>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, dataset>::type
 create_dataset(h5xxObject const& object, std::string const& name, T const& value,
                    StoragePolicy const& storage_policy = StoragePolicy())
 {
@@ -48,10 +52,10 @@ create_dataset(h5xxObject const& object, std::string const& name, T const& value
 }
 
 /**
- * create dataset from a std::vector of fundamental type, using default storage layout
+ * create dataset from a std::vector of fundamental or compound type, using default storage layout
  **/
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, dataset>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, dataset>::type
 create_dataset(h5xxObject const& object, std::string const& name, T const& value)
 {
     return create_dataset(object, name, value, h5xx::policy::storage::contiguous());
@@ -63,7 +67,7 @@ create_dataset(h5xxObject const& object, std::string const& name, T const& value
  * write std::vector data to an existing dataset specified by location and name
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(h5xxObject const& object, std::string const& name, T const& value)
 {
     dataset dset(object, name);
@@ -74,7 +78,7 @@ write_dataset(h5xxObject const& object, std::string const& name, T const& value)
  * write std::vector data to dataset
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(dataset& dset, T const& value)
 {
     typedef typename T::value_type value_type;
@@ -87,7 +91,7 @@ write_dataset(dataset& dset, T const& value)
  * memory and file locations (hyperslabs) are passed via the dataspace objects.
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(h5xxObject const& object, std::string const& name, T const& value,
                   dataspace const& memspace, dataspace const& filespace)
 {
@@ -100,7 +104,7 @@ write_dataset(h5xxObject const& object, std::string const& name, T const& value,
  * the dataspace objects.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(dataset& dset, T const& value, dataspace const& memspace, dataspace const& filespace)
 {
     typedef typename T::value_type value_type;
@@ -116,7 +120,7 @@ write_dataset(dataset& dset, T const& value, dataspace const& memspace, dataspac
  * name, only the file location (hyperslab) is given via a slice object.
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(h5xxObject const& object, std::string const& name, T const& value, slice const& file_slice)
 {
     dataset dset(object, name);
@@ -128,7 +132,7 @@ write_dataset(h5xxObject const& object, std::string const& name, T const& value,
  * (hyperslab) is given via a slice object.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 write_dataset(dataset& dset, T const& value, slice const& file_slice)
 {
     // --- create memory dataspace for the complete input array
@@ -146,7 +150,7 @@ write_dataset(dataset& dset, T const& value, slice const& file_slice)
  * The vector data is resized and overwritten internally.
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(h5xxObject const& object, std::string const& name, T & value)
 {
     dataset dset(object, name);
@@ -158,7 +162,7 @@ read_dataset(h5xxObject const& object, std::string const& name, T & value)
  * The vector data is resized and overwritten internally.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(dataset & data_set, T & value)
 {
     typedef typename T::value_type value_type;
@@ -183,7 +187,7 @@ read_dataset(dataset & data_set, T & value)
  * is not resized internally, the user must resize it in advance to fit the slice.
  */
 template <typename h5xxObject, typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(h5xxObject const& object, std::string const& name, T & value, slice const& file_slice)
 {
     dataset data_set(object, name);
@@ -196,7 +200,7 @@ read_dataset(h5xxObject const& object, std::string const& name, T & value, slice
  * the user must resize it in advance to fit the slice.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(dataset & data_set, T & value, slice const& file_slice)
 {
     // --- create memory dataspace for the complete input array
@@ -215,7 +219,7 @@ read_dataset(dataset & data_set, T & value, slice const& file_slice)
  * dataspace.
  */
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, void>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, void>::type
 read_dataset(dataset & data_set, T & value, dataspace const& memspace, dataspace const& filespace)
 {
     // Assure that the vector has at least the capacity of the dataspace selection.
@@ -233,6 +237,163 @@ read_dataset(dataset & data_set, T & value, dataspace const& memspace, dataspace
     data_set.read(type_id, &*value.begin(), mem_space_id, file_space_id, xfer_plist_id);
 }
 
+/**
+ * create dataset from a std::vector of strings, the string policy determines
+ * the datatype; the size of a fixed-size string type is given by the
+ * longest string
+ **/
+template <typename h5xxObject, typename T, typename StringPolicy, typename StoragePolicy>
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_same<typename T::value_type, std::string> >, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, T const& value
+  , StringPolicy string_policy, StoragePolicy const& storage_policy)
+{
+    size_t str_size = 1;
+    for (size_t i = 0; i < value.size(); ++i) {
+        str_size = std::max(str_size, value[i].size());
+    }
+    hid_t type_id = string_policy.cached_type(str_size);
+    std::vector<hsize_t> dims(1, value.size());
+    dataset dset;
+    try {
+        dset = dataset(object, name, type_id, dataspace(dims), storage_policy);
+    }
+    catch (error const&) {
+        detail::release_type(type_id);
+        throw;
+    }
+    detail::release_type(type_id);
+    return dset;
+}
+
+/**
+ * create dataset from a std::vector of strings, using default storage layout
+ **/
+template <typename h5xxObject, typename T, typename StringPolicy>
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_same<typename T::value_type, std::string> >, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, T const& value, StringPolicy string_policy)
+{
+    return create_dataset(object, name, value, string_policy, h5xx::policy::storage::contiguous());
+}
+
+/**
+ * create dataset from a std::vector of null-terminated strings, using default storage layout
+ **/
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_same<typename T::value_type, std::string> >, dataset>::type
+create_dataset(h5xxObject const& object, std::string const& name, T const& value)
+{
+    return create_dataset(object, name, value, policy::string::null_terminated(), h5xx::policy::storage::contiguous());
+}
+
+/**
+ * write std::vector of strings to a dataset of fixed-size or variable-length
+ * string type; fixed-size strings are truncated to the size of the datatype
+ */
+template <typename T>
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_same<typename T::value_type, std::string> >, void>::type
+write_dataset(dataset& dset, T const& value)
+{
+    if (static_cast<hsize_t>(dataspace(dset).get_select_npoints()) != value.size()) {
+        throw error("size of vector does not match dataspace of dataset \"" + get_name(dset) + "\"");
+    }
+    if (value.empty()) {
+        return;
+    }
+
+    hid_t file_type_id = dset.get_type();
+    bool is_string = H5Tget_class(file_type_id) == H5T_STRING;
+    hid_t type_id = is_string ? detail::cached_string_mem_type(file_type_id) : -1;
+    H5Tclose(file_type_id);
+    if (!is_string) {
+        throw error("dataset \"" + get_name(dset) + "\" is not of string type");
+    }
+    bool is_varlen_str = H5Tis_variable_str(type_id) > 0;
+    size_t str_size = H5Tget_size(type_id);
+
+    if (is_varlen_str) {
+        std::vector<char const*> buffer(value.size());
+        for (size_t i = 0; i < value.size(); ++i) {
+            buffer[i] = value[i].c_str();
+        }
+        dset.write(type_id, &*buffer.begin());
+        detail::release_type(type_id);
+    }
+    else {
+        // pack strings into a single buffer
+        std::vector<char> buffer(value.size() * str_size, '\0');
+        for (size_t i = 0; i < value.size(); ++i) {
+            value[i].copy(&buffer[i * str_size], str_size);
+        }
+        dset.write(type_id, &*buffer.begin());
+        detail::release_type(type_id);
+    }
+}
+
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_same<typename T::value_type, std::string> >, void>::type
+write_dataset(h5xxObject const& object, std::string const& name, T const& value)
+{
+    dataset dset(object, name);
+    write_dataset(dset, value);
+}
+
+/**
+ * Read std::vector of strings from a dataset of fixed-size or
+ * variable-length string type. The vector data is resized and overwritten
+ * internally.
+ */
+template <typename T>
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_same<typename T::value_type, std::string> >, void>::type
+read_dataset(dataset& dset, T& value)
+{
+    dataspace space(dset);
+    size_t size = space.get_select_npoints();
+    value.clear();
+    value.resize(size);
+    if (size == 0) {
+        return;
+    }
+
+    hid_t file_type_id = dset.get_type();
+    bool is_string = H5Tget_class(file_type_id) == H5T_STRING;
+    hid_t type_id = is_string ? detail::cached_string_mem_type(file_type_id) : -1;
+    H5Tclose(file_type_id);
+    if (!is_string) {
+        throw error("dataset \"" + get_name(dset) + "\" is not of string type");
+    }
+    detail::cached_type_ref type(type_id);
+    bool is_varlen_str = H5Tis_variable_str(type_id) > 0;
+    size_t str_size = H5Tget_size(type_id);
+
+    if (is_varlen_str) {
+        // the HDF5 library allocates the strings from the arena, released on return
+        vlen_arena arena(1 << 16);
+        std::vector<char*> buffer(size);
+        detail::read_vlen(dset, type_id, &*buffer.begin(), arena);
+        for (size_t i = 0; i < size; ++i) {
+            if (buffer[i]) {
+                value[i] = buffer[i];
+            }
+        }
+    }
+    else {
+        // read all strings at once
+        std::vector<char> buffer(size * str_size);
+        dset.read(type_id, &*buffer.begin());
+        char const* s = &*buffer.begin();
+        for (size_t i = 0; i < size; ++i, s += str_size) {
+            value[i].assign(s, std::find(s, s + str_size, '\0'));
+        }
+    }
+}
+
+template <typename h5xxObject, typename T>
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_same<typename T::value_type, std::string> >, void>::type
+read_dataset(h5xxObject const& object, std::string const& name, T& value)
+{
+    dataset dset(object, name);
+    read_dataset(dset, value);
+}
 
 } // namespace h5xx
 
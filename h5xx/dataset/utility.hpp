@@ -23,14 +23,7 @@ namespace h5xx {
 template <typename h5xxObject>
 inline bool exists_dataset(h5xxObject const& object, std::string const& name)
 {
-    hid_t hid;
-    H5E_BEGIN_TRY {
-        hid = H5Dopen(object.hid(), name.c_str(), H5P_DEFAULT);
-        if (hid > 0) {
-            H5Dclose(hid);
-        }
-    } H5E_END_TRY
-    return (hid > 0);
+    return get_object_type(object, name) == H5O_TYPE_DATASET;
 }
 
 } // namespace h5xx
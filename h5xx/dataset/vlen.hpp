@@ -0,0 +1,247 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_DATASET_VLEN_HPP
+#define H5XX_DATASET_VLEN_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <h5xx/ctype.hpp>
+#include <h5xx/dataset/dataset.hpp>
+#include <h5xx/dataspace.hpp>
+#include <h5xx/datatype/cache.hpp>
+#include <h5xx/error.hpp>
+#include <h5xx/utility.hpp>
+
+#include <boost/range/iterator_range.hpp>
+#include <boost/type_traits.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/utility/string_ref.hpp>
+
+namespace h5xx {
+
+/**
+ * Bump allocator for variable-length data read by the HDF5 library.
+ *
+ * Installed as memory manager on a dataset transfer property list, it serves
+ * all allocations of a read from a few large blocks; individual elements are
+ * never freed. The memory is released at once by clear() or by the
+ * destructor, which invalidates all views into the arena. The blocks are
+ * kept by clear() and reused by subsequent reads.
+ */
+class vlen_arena
+{
+public:
+    /** construct empty arena, memory is requested in blocks of at least block_size bytes */
+    explicit vlen_arena(size_t block_size = 1 << 20)
+      : block_size_(block_size), current_(0), offset_(0)
+    {}
+
+    /** return aligned memory of given size, valid until clear() */
+    void* allocate(size_t size);
+
+    /** release all memory handed out at once, keep the blocks for reuse */
+    void clear()
+    {
+        current_ = 0;
+        offset_ = 0;
+    }
+
+    /** total size of the blocks in bytes */
+    size_t capacity() const
+    {
+        size_t size = 0;
+        for (size_t i = 0; i < blocks_.size(); ++i) {
+            size += blocks_[i].size;
+        }
+        return size;
+    }
+
+    /**
+     * Return a new dataset transfer property list that uses the arena for
+     * variable-length data. The property list must be closed by the caller.
+     */
+    hid_t create_xfer_plist();
+
+private:
+    struct block
+    {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    enum { alignment = 16 };
+
+    /** callbacks for H5Pset_vlen_mem_manager, they must not throw */
+    static void* allocate_callback(size_t size, void* info);
+    static void free_callback(void*, void*) {}
+
+    size_t block_size_;
+    std::vector<block> blocks_;
+    /** index of block in use and offset of the next free byte therein */
+    size_t current_;
+    size_t offset_;
+};
+
+inline void* vlen_arena::allocate(size_t size)
+{
+    size = (size + alignment - 1) & ~size_t(alignment - 1);
+
+    if (current_ < blocks_.size() && offset_ + size > blocks_[current_].size) {
+        ++current_;
+        offset_ = 0;
+    }
+    if (current_ == blocks_.size() || size > blocks_[current_].size) {
+        block b;
+        b.size = std::max(block_size_, size);
+        b.data.reset(new char[b.size]);
+        blocks_.insert(blocks_.begin() + current_, std::move(b));
+        offset_ = 0;
+    }
+
+    void* p = blocks_[current_].data.get() + offset_;
+    offset_ += size;
+    return p;
+}
+
+inline void* vlen_arena::allocate_callback(size_t size, void* info)
+{
+    try {
+        return static_cast<vlen_arena*>(info)->allocate(size);
+    }
+    catch (std::bad_alloc const&) {
+        return NULL;
+    }
+}
+
+inline hid_t vlen_arena::create_xfer_plist()
+{
+    hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+    if (dxpl < 0 || H5Pset_vlen_mem_manager(dxpl, &allocate_callback, this, &free_callback, this) < 0) {
+        if (dxpl >= 0) {
+            H5Pclose(dxpl);
+        }
+        throw error("setting memory manager for variable-length data");
+    }
+    return dxpl;
+}
+
+namespace detail {
+
+/**
+ * read variable-length data of the whole dataset with given memory type into
+ * buffer, the HDF5 library allocates the data from the arena
+ */
+inline void read_vlen(dataset& dset, hid_t mem_type_id, void* buffer, vlen_arena& arena)
+{
+    hid_t dxpl = arena.create_xfer_plist();
+    try {
+        dset.read(mem_type_id, buffer, H5S_ALL, H5S_ALL, dxpl);
+    }
+    catch (...) {
+        H5Pclose(dxpl);
+        throw;
+    }
+    H5Pclose(dxpl);
+}
+
+} // namespace detail
+
+/**
+ * Read a dataset of variable-length strings as views into the arena, without
+ * allocating memory per string. The views are valid until the arena is
+ * cleared or destroyed. The vector is resized and overwritten internally.
+ */
+template <typename T>
+inline typename boost::enable_if<boost::is_same<T, boost::string_ref>, void>::type
+read_dataset(dataset& dset, std::vector<T>& value, vlen_arena& arena)
+{
+    hid_t file_type_id = dset.get_type();
+    bool is_varlen_str = H5Tis_variable_str(file_type_id) > 0;
+    hid_t type_id = is_varlen_str ? detail::cached_string_mem_type(file_type_id) : -1;
+    H5Tclose(file_type_id);
+    if (!is_varlen_str) {
+        throw error("dataset \"" + get_name(dset) + "\" is not of variable-length string type");
+    }
+
+    size_t size = dataspace(dset).get_select_npoints();
+    value.clear();
+    if (size > 0) {
+        // the array of pointers is placed in the arena as well
+        char** buffer = static_cast<char**>(arena.allocate(size * sizeof(char*)));
+        try {
+            detail::read_vlen(dset, type_id, buffer, arena);
+        }
+        catch (error const&) {
+            detail::release_type(type_id);
+            throw;
+        }
+        value.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            value.push_back(buffer[i] ? T(buffer[i], std::strlen(buffer[i])) : T());
+        }
+    }
+    detail::release_type(type_id);
+}
+
+/**
+ * Read a dataset of variable-length sequences of type T (e.g., ragged
+ * arrays) as ranges into the arena, without allocating memory per sequence.
+ * The ranges are valid until the arena is cleared or destroyed. The vector
+ * is resized and overwritten internally.
+ */
+template <typename T>
+inline typename boost::enable_if<detail::has_ctype<T>, void>::type
+read_dataset(dataset& dset, std::vector<boost::iterator_range<T const*> >& value, vlen_arena& arena)
+{
+    hid_t file_type_id = dset.get_type();
+    bool is_vlen = H5Tget_class(file_type_id) == H5T_VLEN;
+    H5Tclose(file_type_id);
+    if (!is_vlen) {
+        throw error("dataset \"" + get_name(dset) + "\" is not of variable-length type");
+    }
+
+    size_t size = dataspace(dset).get_select_npoints();
+    value.clear();
+    if (size > 0) {
+        hid_t type_id = detail::cached_vlen_type(ctype<T>::hid());
+        hvl_t* buffer = static_cast<hvl_t*>(arena.allocate(size * sizeof(hvl_t)));
+        try {
+            detail::read_vlen(dset, type_id, buffer, arena);
+        }
+        catch (error const&) {
+            detail::release_type(type_id);
+            throw;
+        }
+        detail::release_type(type_id);
+        value.reserve(size);
+        for (size_t i = 0; i < size; ++i) {
+            T const* first = static_cast<T const*>(buffer[i].p);
+            value.push_back(boost::iterator_range<T const*>(first, first + buffer[i].len));
+        }
+    }
+}
+
+template <typename h5xxObject, typename T>
+inline void read_dataset(h5xxObject const& object, std::string const& name, std::vector<T>& value, vlen_arena& arena)
+{
+    dataset dset(object, name);
+    read_dataset(dset, value, arena);
+}
+
+} // namespace h5xx
+
+#endif // ! H5XX_DATASET_VLEN_HPP
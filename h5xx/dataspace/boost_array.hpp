@@ -12,6 +12,7 @@
 #ifndef H5XX_DATASPACE_BOOST_ARRAY
 #define H5XX_DATASPACE_BOOST_ARRAY
 
+#include <h5xx/ctype.hpp>
 #include <h5xx/dataspace.hpp>
 
 #include <boost/array.hpp>
@@ -23,7 +24,7 @@
 namespace h5xx {
 
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_array<T>, boost::is_fundamental<typename T::value_type> >, dataspace>::type
+inline typename boost::enable_if< boost::mpl::and_< is_array<T>, detail::has_ctype<typename T::value_type> >, dataspace>::type
 create_dataspace(T const& value)
 {
     const int rank = 1;
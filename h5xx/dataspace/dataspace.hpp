@@ -253,9 +253,9 @@ dataspace::dataspace(boost::array<hsize_t, N> const& dims, boost::array<hsize_t,
 
 inline dataspace::~dataspace()
 {
+    // destructors must not throw, a failure cannot be reported
     if (hid_ >= 0) {
-        if(H5Sclose(hid_) < 0)
-            throw error("closing h5xx::dataspace with ID " + boost::lexical_cast<std::string>(hid_));
+        H5Sclose(hid_);
         hid_ = -1;
     }
 }
@@ -14,6 +14,7 @@
 
 #include <vector>
 
+#include <h5xx/ctype.hpp>
 #include <h5xx/dataspace.hpp>
 
 #include <boost/lexical_cast.hpp>
@@ -24,7 +25,7 @@
 namespace h5xx {
 
 template <typename T>
-inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> >, dataspace>::type
+inline typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> >, dataspace>::type
 create_dataspace(T const& value)
 {
     std::vector<hsize_t> value_dims;
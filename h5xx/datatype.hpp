@@ -12,6 +12,7 @@
 #ifndef H5XX_DATATYPE_HPP
 #define H5XX_DATATYPE_HPP
 
+#include <h5xx/datatype/cache.hpp>
 #include <h5xx/datatype/datatype.hpp>
 
 #endif // ! H5XX_DATATYPE_HPP
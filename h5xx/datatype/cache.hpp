@@ -0,0 +1,212 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_DATATYPE_CACHE_HPP
+#define H5XX_DATATYPE_CACHE_HPP
+
+#include <h5xx/hdf5_compat.hpp>
+#include <h5xx/error.hpp>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace h5xx {
+namespace detail {
+
+/**
+ * Cache of derived HDF5 datatypes, e.g., string types of a given size, which
+ * are created once per process instead of upon each read or write.
+ *
+ * The cache owns one reference to each datatype. A lookup hands out an
+ * additional reference, which the caller releases with release_type(). The
+ * cached datatypes are shared by all threads and locked with H5Tlock(), they
+ * can neither be modified nor closed with H5Tclose().
+ */
+template <typename Key>
+class datatype_cache
+{
+public:
+    /**
+     * Return the datatype stored under the given key, or create it by
+     * calling 'create()' and store it. An entry whose ID has become invalid
+     * (e.g., after H5close) is created anew.
+     */
+    template <typename Factory>
+    hid_t get(Key const& key, Factory create)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        typename std::map<Key, hid_t>::iterator it = types_.find(key);
+        if (it == types_.end() || H5Iis_valid(it->second) <= 0 || H5Iget_type(it->second) != H5I_DATATYPE) {
+            hid_t type_id = create();
+            if (H5Tlock(type_id) < 0) {
+                H5Tclose(type_id);
+                throw error("locking cached datatype");
+            }
+            it = types_.insert(std::make_pair(key, type_id)).first;
+            it->second = type_id;
+        }
+        if (H5Iinc_ref(it->second) < 0) {
+            throw error("acquiring reference to cached datatype");
+        }
+        return it->second;
+    }
+
+    /** per-process instance */
+    static datatype_cache& instance()
+    {
+        static datatype_cache cache;
+        return cache;
+    }
+
+private:
+    std::mutex mutex_;
+    std::map<Key, hid_t> types_;
+};
+
+/**
+ * Release a datatype obtained from the cache, e.g., by cached_type() of a
+ * string policy. Returns a negative value on failure.
+ */
+inline herr_t release_type(hid_t type_id)
+{
+    return H5Idec_ref(type_id) < 0 ? -1 : 0;
+}
+
+/** reference to a datatype obtained from the cache, released upon destruction */
+class cached_type_ref
+{
+public:
+    explicit cached_type_ref(hid_t type_id) : hid_(type_id) {}
+    ~cached_type_ref() { release_type(hid_); }
+
+    cached_type_ref(cached_type_ref const&) = delete;
+    cached_type_ref& operator=(cached_type_ref const&) = delete;
+
+    /** return HDF5 object ID */
+    hid_t hid() const
+    {
+        return hid_;
+    }
+
+private:
+    hid_t hid_;
+};
+
+/**
+ * Return an unlocked copy of a datatype obtained from the cache, which is
+ * owned by the caller and closed with H5Tclose(). The reference to the
+ * cached datatype is released.
+ */
+inline hid_t copy_cached_type(hid_t type_id)
+{
+    hid_t copy_id = H5Tcopy(type_id);
+    release_type(type_id);
+    if (copy_id < 0) {
+        throw error("copying cached datatype");
+    }
+    return copy_id;
+}
+
+/** key of a string datatype: size (or H5T_VARIABLE), padding, character set */
+struct string_type_key
+{
+    size_t size;
+    H5T_str_t strpad;
+    H5T_cset_t cset;
+
+    bool operator<(string_type_key const& other) const
+    {
+        if (size != other.size) {
+            return size < other.size;
+        }
+        if (strpad != other.strpad) {
+            return strpad < other.strpad;
+        }
+        return cset < other.cset;
+    }
+};
+
+/**
+ * Return a C string datatype of given size, padding and character set from
+ * the cache. Use size = H5T_VARIABLE for variable-length strings. The caller
+ * must release the returned ID.
+ */
+inline hid_t cached_string_type(size_t size, H5T_str_t strpad = H5T_STR_NULLTERM, H5T_cset_t cset = H5T_CSET_ASCII)
+{
+    string_type_key key = { size, strpad, cset };
+    return datatype_cache<string_type_key>::instance().get(key, [&key]() {
+        hid_t type_id = H5Tcopy(H5T_C_S1);
+        bool err = type_id < 0;
+        err |= H5Tset_size(type_id, key.size) < 0;
+        err |= H5Tset_strpad(type_id, key.strpad) < 0;
+        err |= H5Tset_cset(type_id, key.cset) < 0;
+        if (err) {
+            if (type_id >= 0) {
+                H5Tclose(type_id);
+            }
+            throw error("creating string datatype");
+        }
+        return type_id;
+    });
+}
+
+/** key of a variable-length sequence datatype: base type */
+struct vlen_type_key
+{
+    hid_t base_type_id;
+
+    bool operator<(vlen_type_key const& other) const
+    {
+        return base_type_id < other.base_type_id;
+    }
+};
+
+/**
+ * Return a variable-length sequence datatype of the given base type, which
+ * must itself be a cached or predefined type (e.g., from ctype<T>::hid()).
+ * The caller must release the returned ID.
+ */
+inline hid_t cached_vlen_type(hid_t base_type_id)
+{
+    vlen_type_key key = { base_type_id };
+    return datatype_cache<vlen_type_key>::instance().get(key, [base_type_id]() {
+        hid_t type_id = H5Tvlen_create(base_type_id);
+        if (type_id < 0) {
+            throw error("creating variable-length datatype");
+        }
+        return type_id;
+    });
+}
+
+/**
+ * Return a cached memory datatype for reading or writing data of the given
+ * string file type without truncation: size and character set are
+ * preserved, space padding is replaced by null padding. Throws if the file
+ * type is not a string type. The caller must release the returned ID.
+ */
+inline hid_t cached_string_mem_type(hid_t file_type_id)
+{
+    if (H5Tget_class(file_type_id) != H5T_STRING) {
+        throw error("datatype is not a string type");
+    }
+    H5T_cset_t cset = H5Tget_cset(file_type_id);
+    if (H5Tis_variable_str(file_type_id) > 0) {
+        return cached_string_type(H5T_VARIABLE, H5T_STR_NULLTERM, cset);
+    }
+    H5T_str_t strpad = H5Tget_strpad(file_type_id) == H5T_STR_NULLTERM ? H5T_STR_NULLTERM : H5T_STR_NULLPAD;
+    return cached_string_type(H5Tget_size(file_type_id), strpad, cset);
+}
+
+} // namespace detail
+} // namespace h5xx
+
+#endif /* ! H5XX_DATATYPE_CACHE_HPP */
@@ -45,7 +45,7 @@ public:
 
     /** create datatype object from a std::vector */
     template <class T>
-    datatype(T vector, typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> > >::type* dummy = 0);
+    datatype(T vector, typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> > >::type* dummy = 0);
 
     /** return the HDF5 type ID */
     hid_t get_type_id() const;
@@ -70,7 +70,7 @@ datatype::datatype(T array, typename boost::enable_if<is_array<T> >::type* dummy
 }
 
 template <class T>
-datatype::datatype(T vector, typename boost::enable_if< boost::mpl::and_< is_vector<T>, boost::is_fundamental<typename T::value_type> > >::type* dummy)
+datatype::datatype(T vector, typename boost::enable_if< boost::mpl::and_< is_vector<T>, detail::has_ctype<typename T::value_type> > >::type* dummy)
 {
     typedef typename T::value_type value_type;
     type_id_ = ctype<value_type>::hid();
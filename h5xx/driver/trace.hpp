@@ -0,0 +1,263 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_DRIVER_TRACE_HPP
+#define H5XX_DRIVER_TRACE_HPP
+
+#include <h5xx/hdf5_compat.hpp>
+#include <h5xx/trace.hpp>
+#if H5_VERSION_GE(1,13,0)
+# include <H5FDdevelop.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include <sys/types.h>
+
+namespace h5xx {
+namespace detail {
+
+/**
+ * Tracing virtual file driver: all operations are passed to an underlying
+ * driver, which is opened with the original file access property list, and
+ * reads and writes are timed and recorded in an h5xx::io_trace collector.
+ * The file format is unchanged. Selected by file_options::trace.
+ */
+namespace trace {
+
+/** driver properties, the property list of the underlying driver is owned */
+struct fapl_type
+{
+    hid_t under_fapl;
+    io_trace* sink;
+};
+
+/** file struct passed to the HDF5 library, the public part must be first */
+struct handle
+{
+    H5FD_t pub;
+    H5FD_t* under;
+    fapl_type config;
+    std::string name;
+};
+
+inline handle* get_handle(H5FD_t const* file)
+{
+    return const_cast<handle*>(reinterpret_cast<handle const*>(file));
+}
+
+// --- callbacks of the driver class, they must not throw
+
+inline void* fapl_copy(void const* fapl)
+{
+    fapl_type const* src = static_cast<fapl_type const*>(fapl);
+    fapl_type* copy = static_cast<fapl_type*>(std::malloc(sizeof(fapl_type)));
+    if (copy) {
+        copy->sink = src->sink;
+        copy->under_fapl = H5Pcopy(src->under_fapl);
+        if (copy->under_fapl < 0) {
+            std::free(copy);
+            return NULL;
+        }
+    }
+    return copy;
+}
+
+inline herr_t fapl_free(void* fapl)
+{
+    herr_t err = H5Pclose(static_cast<fapl_type*>(fapl)->under_fapl);
+    std::free(fapl);
+    return err;
+}
+
+inline void* fapl_get(H5FD_t* file)
+{
+    return fapl_copy(&get_handle(file)->config);
+}
+
+inline H5FD_t* open(char const* name, unsigned flags, hid_t fapl_id, haddr_t maxaddr)
+{
+    fapl_type const* info = static_cast<fapl_type const*>(H5Pget_driver_info(fapl_id));
+    if (!info || !info->sink) {
+        return NULL;
+    }
+    handle* h = NULL;
+    try {
+        h = new handle();
+        h->name = name;
+    }
+    catch (...) {
+        delete h;
+        return NULL;
+    }
+    h->under = H5FDopen(name, flags, info->under_fapl, maxaddr);
+    h->config.sink = info->sink;
+    h->config.under_fapl = h->under ? H5Pcopy(info->under_fapl) : -1;
+    if (h->config.under_fapl < 0) {
+        if (h->under) {
+            H5FDclose(h->under);
+        }
+        delete h;
+        return NULL;
+    }
+    return &h->pub;
+}
+
+inline herr_t close(H5FD_t* file)
+{
+    handle* h = get_handle(file);
+    herr_t err = H5FDclose(h->under);
+    H5Pclose(h->config.under_fapl);
+    try {
+        h->config.sink->close_file(h->name);
+    }
+    catch (...) {
+        err = -1;
+    }
+    delete h;
+    return err;
+}
+
+inline int cmp(H5FD_t const* f1, H5FD_t const* f2)
+{
+    return H5FDcmp(get_handle(f1)->under, get_handle(f2)->under);
+}
+
+/** without file, the library asks for the features of the driver class */
+inline herr_t query(H5FD_t const* file, unsigned long* flags)
+{
+    if (!file) {
+        if (flags) {
+            *flags = H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA
+                   | H5FD_FEAT_DATA_SIEVE | H5FD_FEAT_AGGREGATE_SMALLDATA;
+        }
+        return 0;
+    }
+    return H5FDquery(get_handle(file)->under, flags);
+}
+
+inline haddr_t get_eoa(H5FD_t const* file, H5FD_mem_t type)
+{
+    return H5FDget_eoa(get_handle(file)->under, type);
+}
+
+inline herr_t set_eoa(H5FD_t* file, H5FD_mem_t type, haddr_t addr)
+{
+    return H5FDset_eoa(get_handle(file)->under, type, addr);
+}
+
+inline haddr_t get_eof(H5FD_t const* file, H5FD_mem_t type)
+{
+    return H5FDget_eof(get_handle(file)->under, type);
+}
+
+inline herr_t get_vfd_handle(H5FD_t* file, hid_t fapl, void** file_handle)
+{
+    return H5FDget_vfd_handle(get_handle(file)->under, fapl, file_handle);
+}
+
+/** pass a read or write to the underlying driver and record it */
+template <bool Write, typename Buffer>
+inline herr_t transfer(H5FD_t* file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size, Buffer buf)
+{
+    typedef std::chrono::steady_clock clock;
+    handle* h = get_handle(file);
+    clock::time_point start = clock::now();
+    herr_t err = Write
+      ? H5FDwrite(h->under, type, dxpl_id, addr, size, buf)
+      : H5FDread(h->under, type, dxpl_id, addr, size, const_cast<void*>(static_cast<void const*>(buf)));
+    double seconds = std::chrono::duration<double>(clock::now() - start).count();
+    if (err >= 0) {
+        try {
+            h->config.sink->record(h->name, Write, type == H5FD_MEM_DRAW, size, seconds);
+        }
+        catch (...) {}      // statistics are lost, the data are not
+    }
+    return err;
+}
+
+inline herr_t read(H5FD_t* file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size, void* buf)
+{
+    return transfer<false>(file, type, dxpl_id, addr, size, buf);
+}
+
+inline herr_t write(H5FD_t* file, H5FD_mem_t type, hid_t dxpl_id, haddr_t addr, size_t size, void const* buf)
+{
+    return transfer<true>(file, type, dxpl_id, addr, size, buf);
+}
+
+inline herr_t flush(H5FD_t* file, hid_t dxpl_id, hbool_t closing)
+{
+    return H5FDflush(get_handle(file)->under, dxpl_id, closing);
+}
+
+inline herr_t truncate(H5FD_t* file, hid_t dxpl_id, hbool_t closing)
+{
+    return H5FDtruncate(get_handle(file)->under, dxpl_id, closing);
+}
+
+inline H5FD_class_t make_class()
+{
+    H5FD_class_t cls;
+    std::memset(&cls, 0, sizeof(cls));
+#if H5_VERSION_GE(1,13,2)
+    cls.version = H5FD_CLASS_VERSION;
+    cls.value = static_cast<H5FD_class_value_t>(601);
+#endif
+    cls.name = "h5xx_trace";
+    cls.maxaddr = (haddr_t(1) << (8 * sizeof(off_t) - 1)) - 1;
+    cls.fc_degree = H5F_CLOSE_WEAK;
+    cls.fapl_size = sizeof(fapl_type);
+    cls.fapl_get = &fapl_get;
+    cls.fapl_copy = &fapl_copy;
+    cls.fapl_free = &fapl_free;
+    cls.open = &open;
+    cls.close = &close;
+    cls.cmp = &cmp;
+    cls.query = &query;
+    cls.get_eoa = &get_eoa;
+    cls.set_eoa = &set_eoa;
+    cls.get_eof = &get_eof;
+    cls.get_handle = &get_vfd_handle;
+    cls.read = &read;
+    cls.write = &write;
+    cls.flush = &flush;
+    cls.truncate = &truncate;
+    H5FD_mem_t fl_map[H5FD_MEM_NTYPES] = H5FD_FLMAP_DICHOTOMY;
+    std::copy(fl_map, fl_map + H5FD_MEM_NTYPES, cls.fl_map);
+    return cls;
+}
+
+/** per-process driver class, which the HDF5 library refers to */
+inline H5FD_class_t const* driver_class()
+{
+    static H5FD_class_t const cls = make_class();
+    return &cls;
+}
+
+/** register the driver once per library session and return its ID */
+inline hid_t driver_id()
+{
+    static hid_t id = -1;
+    if (id < 0 || H5Iis_valid(id) <= 0 || H5Iget_type(id) != H5I_VFL) {
+        id = H5FDregister(driver_class());
+    }
+    return id;
+}
+
+} // namespace trace
+} // namespace detail
+} // namespace h5xx
+
+#endif /* ! H5XX_DRIVER_TRACE_HPP */
@@ -0,0 +1,510 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_DRIVER_WRITE_BEHIND_HPP
+#define H5XX_DRIVER_WRITE_BEHIND_HPP
+
+#include <h5xx/file.hpp>
+#include <h5xx/hdf5_compat.hpp>
+
+#if !defined(_WIN32)
+
+#if H5_VERSION_GE(1,13,0)
+# include <H5FDdevelop.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace h5xx {
+namespace detail {
+
+/**
+ * Write-behind virtual file driver: writes are collected in large in-memory
+ * segments, adjacent small writes are merged, and full segments are written
+ * to the POSIX file by a background thread. A bounded queue of segments
+ * limits the memory use and throttles the application if the disk cannot
+ * keep up. Flushing and closing the file wait for all segments.
+ *
+ * Reads see all previous writes. The file format is unchanged, files may be
+ * opened later with any other driver. The driver is selected by
+ * file_options::write_behind; it does not support SWMR access.
+ *
+ * The driver relies on POSIX file I/O and is therefore not part of
+ * h5xx/file.hpp. Including this header in any translation unit of a program
+ * installs the driver for file_options::write_behind.
+ */
+namespace write_behind {
+
+struct segment
+{
+    haddr_t addr;
+    std::vector<char> data;
+
+    haddr_t end() const { return addr + data.size(); }
+};
+
+/** write all bytes at given offset, returns false on failure */
+inline bool pwrite_all(int fd, char const* buf, size_t size, haddr_t addr)
+{
+    while (size > 0) {
+        ssize_t n = ::pwrite(fd, buf, size, static_cast<off_t>(addr));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        buf += n;
+        size -= n;
+        addr += n;
+    }
+    return true;
+}
+
+/** read at given offset, beyond the end of the file the buffer is zero-filled */
+inline bool pread_all(int fd, char* buf, size_t size, haddr_t addr)
+{
+    while (size > 0) {
+        ssize_t n = ::pread(fd, buf, size, static_cast<off_t>(addr));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n < 0) {
+            return false;
+        }
+        if (n == 0) {
+            std::memset(buf, 0, size);
+            break;
+        }
+        buf += n;
+        size -= n;
+        addr += n;
+    }
+    return true;
+}
+
+/** state of an open file, owns the file descriptor and the flusher thread */
+class file_impl
+{
+public:
+    file_impl(int fd, fapl_type const& config, haddr_t eof)
+      : fd(fd), eoa(0), eof(eof), config_(config), stop_(false), error_(0)
+    {
+        thread_ = std::thread(&file_impl::run, this);
+    }
+
+    /** waits for pending segments, stops the thread and closes the file */
+    ~file_impl()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cond_.notify_all();
+        thread_.join();
+        ::close(fd);
+    }
+
+    bool write(haddr_t addr, size_t size, void const* buf);
+    bool read(haddr_t addr, size_t size, void* buf);
+
+    /** write the current segment and wait for the queue to drain */
+    bool flush();
+
+    fapl_type const& config() const { return config_; }
+
+    int fd;
+    haddr_t eoa;
+    haddr_t eof;
+
+private:
+    /** pass current segment to the flusher thread, waits if the queue is full */
+    void submit();
+
+    /** body of the flusher thread */
+    void run();
+
+    fapl_type config_;
+    segment current_;
+
+    /** protects the following members */
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    /** segments to be written, the front is being written */
+    std::deque<segment> queue_;
+    bool stop_;
+    int error_;
+
+    std::thread thread_;
+};
+
+inline void file_impl::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        cond_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) {
+            break;
+        }
+        // references to deque elements remain valid upon push_back
+        segment const& seg = queue_.front();
+        lock.unlock();
+        bool ok = pwrite_all(fd, &*seg.data.begin(), seg.data.size(), seg.addr);
+        int err = errno;
+        lock.lock();
+        if (!ok && !error_) {
+            error_ = err ? err : EIO;
+        }
+        queue_.pop_front();
+        cond_.notify_all();
+    }
+}
+
+inline void file_impl::submit()
+{
+    if (current_.data.empty()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cond_.wait(lock, [this]() { return queue_.size() < std::max(config_.queue_depth, 1u); });
+        queue_.push_back(std::move(current_));
+    }
+    cond_.notify_all();
+    current_ = segment();
+}
+
+inline bool file_impl::write(haddr_t addr, size_t size, void const* buf)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (error_) {
+            return false;
+        }
+    }
+    char const* data = static_cast<char const*>(buf);
+    bool empty = current_.data.empty();
+
+    if (!empty && addr >= current_.addr && addr + size <= current_.end()) {
+        // overwrite within the current segment
+        std::memcpy(&current_.data[addr - current_.addr], data, size);
+    }
+    else if (!empty && addr == current_.end() && current_.data.size() + size <= config_.segment_size) {
+        // append to the current segment
+        current_.data.insert(current_.data.end(), data, data + size);
+    }
+    else {
+        submit();
+        current_.addr = addr;
+        current_.data.reserve(std::max(config_.segment_size, size));
+        current_.data.assign(data, data + size);
+        if (size >= config_.segment_size) {
+            submit();
+        }
+    }
+    eof = std::max<haddr_t>(eof, addr + size);
+    return true;
+}
+
+inline bool file_impl::read(haddr_t addr, size_t size, void* buf)
+{
+    {
+        // wait for queued segments that overlap the requested range
+        std::unique_lock<std::mutex> lock(mutex_);
+        bool overlap = false;
+        for (std::deque<segment>::const_iterator it = queue_.begin(); it != queue_.end(); ++it) {
+            overlap |= it->addr < addr + size && addr < it->end();
+        }
+        if (overlap) {
+            cond_.wait(lock, [this]() { return queue_.empty(); });
+        }
+        if (error_) {
+            return false;
+        }
+    }
+
+    if (!pread_all(fd, static_cast<char*>(buf), size, addr)) {
+        return false;
+    }
+
+    // overlay data of the current segment
+    if (!current_.data.empty() && current_.addr < addr + size && addr < current_.end()) {
+        haddr_t first = std::max(addr, current_.addr);
+        haddr_t last = std::min(addr + size, current_.end());
+        std::memcpy(static_cast<char*>(buf) + (first - addr), &current_.data[first - current_.addr], last - first);
+    }
+    return true;
+}
+
+inline bool file_impl::flush()
+{
+    submit();
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this]() { return queue_.empty(); });
+    return error_ == 0;
+}
+
+/** file struct passed to the HDF5 library, the public part must be first */
+struct handle
+{
+    H5FD_t pub;
+    file_impl* impl;
+    dev_t device;
+    ino_t inode;
+};
+
+inline file_impl* get_impl(H5FD_t const* file)
+{
+    return reinterpret_cast<handle const*>(file)->impl;
+}
+
+// --- callbacks of the driver class, they must not throw
+
+inline void* fapl_copy(void const* fapl)
+{
+    void* copy = std::malloc(sizeof(fapl_type));
+    if (copy) {
+        std::memcpy(copy, fapl, sizeof(fapl_type));
+    }
+    return copy;
+}
+
+inline herr_t fapl_free(void* fapl)
+{
+    std::free(fapl);
+    return 0;
+}
+
+inline void* fapl_get(H5FD_t* file)
+{
+    return fapl_copy(&get_impl(file)->config());
+}
+
+inline H5FD_t* open(char const* name, unsigned flags, hid_t fapl_id, haddr_t)
+{
+    fapl_type config = { 4 << 20, 4 };
+    void const* info = H5Pget_driver_info(fapl_id);
+    if (info) {
+        config = *static_cast<fapl_type const*>(info);
+    }
+
+    int o_flags = (flags & H5F_ACC_RDWR) ? O_RDWR : O_RDONLY;
+    o_flags |= (flags & H5F_ACC_TRUNC) ? O_TRUNC : 0;
+    o_flags |= (flags & H5F_ACC_CREAT) ? O_CREAT : 0;
+    o_flags |= (flags & H5F_ACC_EXCL) ? O_EXCL : 0;
+    int fd = ::open(name, o_flags, 0666);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat sb;
+    if (fstat(fd, &sb) < 0) {
+        ::close(fd);
+        return NULL;
+    }
+
+    handle* h = NULL;
+    try {
+        h = new handle();
+        h->impl = new file_impl(fd, config, sb.st_size);
+    }
+    catch (...) {
+        delete h;
+        ::close(fd);
+        return NULL;
+    }
+    h->device = sb.st_dev;
+    h->inode = sb.st_ino;
+    return &h->pub;
+}
+
+inline herr_t close(H5FD_t* file)
+{
+    handle* h = reinterpret_cast<handle*>(file);
+    bool ok = h->impl->flush();
+    delete h->impl;
+    delete h;
+    return ok ? 0 : -1;
+}
+
+inline int cmp(H5FD_t const* f1, H5FD_t const* f2)
+{
+    handle const* h1 = reinterpret_cast<handle const*>(f1);
+    handle const* h2 = reinterpret_cast<handle const*>(f2);
+    if (h1->device != h2->device) {
+        return h1->device < h2->device ? -1 : 1;
+    }
+    if (h1->inode != h2->inode) {
+        return h1->inode < h2->inode ? -1 : 1;
+    }
+    return 0;
+}
+
+inline herr_t query(H5FD_t const*, unsigned long* flags)
+{
+    if (flags) {
+        *flags = H5FD_FEAT_AGGREGATE_METADATA | H5FD_FEAT_ACCUMULATE_METADATA
+               | H5FD_FEAT_DATA_SIEVE | H5FD_FEAT_AGGREGATE_SMALLDATA;
+    }
+    return 0;
+}
+
+inline haddr_t get_eoa(H5FD_t const* file, H5FD_mem_t)
+{
+    return get_impl(file)->eoa;
+}
+
+inline herr_t set_eoa(H5FD_t* file, H5FD_mem_t, haddr_t addr)
+{
+    get_impl(file)->eoa = addr;
+    return 0;
+}
+
+inline haddr_t get_eof(H5FD_t const* file, H5FD_mem_t)
+{
+    return get_impl(file)->eof;
+}
+
+inline herr_t get_handle(H5FD_t* file, hid_t, void** file_handle)
+{
+    *file_handle = &get_impl(file)->fd;
+    return 0;
+}
+
+inline herr_t read(H5FD_t* file, H5FD_mem_t, hid_t, haddr_t addr, size_t size, void* buf)
+{
+    file_impl* impl = get_impl(file);
+    if (addr == HADDR_UNDEF || addr + size > impl->eoa) {
+        return -1;
+    }
+    try {
+        return impl->read(addr, size, buf) ? 0 : -1;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+inline herr_t write(H5FD_t* file, H5FD_mem_t, hid_t, haddr_t addr, size_t size, void const* buf)
+{
+    file_impl* impl = get_impl(file);
+    if (addr == HADDR_UNDEF || addr + size > impl->eoa) {
+        return -1;
+    }
+    try {
+        return impl->write(addr, size, buf) ? 0 : -1;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+inline herr_t flush(H5FD_t* file, hid_t, hbool_t)
+{
+    try {
+        return get_impl(file)->flush() ? 0 : -1;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+inline herr_t truncate(H5FD_t* file, hid_t, hbool_t)
+{
+    file_impl* impl = get_impl(file);
+    try {
+        if (!impl->flush()) {
+            return -1;
+        }
+    }
+    catch (...) {
+        return -1;
+    }
+    if (impl->eoa != impl->eof) {
+        if (ftruncate(impl->fd, static_cast<off_t>(impl->eoa)) < 0) {
+            return -1;
+        }
+        impl->eof = impl->eoa;
+    }
+    return 0;
+}
+
+inline H5FD_class_t make_class()
+{
+    H5FD_class_t cls;
+    std::memset(&cls, 0, sizeof(cls));
+#if H5_VERSION_GE(1,13,2)
+    cls.version = H5FD_CLASS_VERSION;
+    cls.value = static_cast<H5FD_class_value_t>(600);
+#endif
+    cls.name = "h5xx_write_behind";
+    cls.maxaddr = (haddr_t(1) << (8 * sizeof(off_t) - 1)) - 1;
+    cls.fc_degree = H5F_CLOSE_WEAK;
+    cls.fapl_size = sizeof(fapl_type);
+    cls.fapl_get = &fapl_get;
+    cls.fapl_copy = &fapl_copy;
+    cls.fapl_free = &fapl_free;
+    cls.open = &open;
+    cls.close = &close;
+    cls.cmp = &cmp;
+    cls.query = &query;
+    cls.get_eoa = &get_eoa;
+    cls.set_eoa = &set_eoa;
+    cls.get_eof = &get_eof;
+    cls.get_handle = &get_handle;
+    cls.read = &read;
+    cls.write = &write;
+    cls.flush = &flush;
+    cls.truncate = &truncate;
+    H5FD_mem_t fl_map[H5FD_MEM_NTYPES] = H5FD_FLMAP_DICHOTOMY;
+    std::copy(fl_map, fl_map + H5FD_MEM_NTYPES, cls.fl_map);
+    return cls;
+}
+
+/** per-process driver class, which the HDF5 library refers to */
+inline H5FD_class_t const* driver_class()
+{
+    static H5FD_class_t const cls = make_class();
+    return &cls;
+}
+
+/** register the driver once per library session and return its ID */
+inline hid_t driver_id()
+{
+    static hid_t id = -1;
+    if (id < 0 || H5Iis_valid(id) <= 0 || H5Iget_type(id) != H5I_VFL) {
+        id = H5FDregister(driver_class());
+    }
+    return id;
+}
+
+/** install the driver for file_options::write_behind upon static initialisation */
+static bool const installed = (installed_driver() = &driver_id, true);
+
+} // namespace write_behind
+} // namespace detail
+} // namespace h5xx
+
+#endif /* ! _WIN32 */
+
+#endif /* ! H5XX_DRIVER_WRITE_BEHIND_HPP */
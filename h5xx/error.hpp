@@ -11,10 +11,60 @@
 #ifndef H5XX_ERROR_HPP
 #define H5XX_ERROR_HPP
 
+#include <h5xx/hdf5_compat.hpp>
+
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace h5xx {
 
+/**
+ * Outcome of an operation of the non-throwing API (see h5xx/try.hpp).
+ *
+ * On failure, the status holds the failed action, the name of the object
+ * concerned and, optionally, the ID of the HDF5 location of the object.
+ * The message is assembled only if requested by message(), so that failures
+ * in hot loops cost neither string formatting nor name lookups. The location
+ * is not referenced by the status and does not outlive its object; it is
+ * omitted from the message if it has been closed in the meantime.
+ */
+class status
+{
+public:
+    enum code_type
+    {
+        success = 0
+      , not_found           /* object or attribute does not exist */
+      , type_mismatch       /* object is of different type, e.g., a group instead of a dataset */
+      , failure             /* the HDF5 library reported an error */
+    };
+
+    status() : code_(success), action_(0), loc_id_(-1) {}
+
+    /** 'action' must be a string literal */
+    status(code_type code, char const* action, std::string const& name = std::string(), hid_t loc_id = -1)
+      : code_(code), action_(action), name_(name), loc_id_(loc_id) {}
+
+    code_type code() const { return code_; }
+
+    bool ok() const { return code_ == success; }
+
+    explicit operator bool() const { return ok(); }
+
+    /** describe the failure, empty on success */
+    std::string message() const;
+
+    /** throw h5xx::error on failure */
+    void raise() const;
+
+private:
+    code_type code_;
+    char const* action_;
+    std::string name_;
+    hid_t loc_id_;
+};
+
 /**
  * h5xx wrapper error
  */
@@ -23,7 +73,11 @@ class error
 {
 public:
     error(std::string const& desc)
-        : desc_(desc) {}
+        : code_(status::failure), desc_(desc) {}
+
+    /** the description is assembled from the status while its location is still open */
+    explicit error(status const& s)
+        : code_(s.code()), desc_(s.message()) {}
 
     virtual ~error() throw() {}
 
@@ -32,10 +86,51 @@ public:
         return desc_.c_str();
     }
 
+    status::code_type code() const
+    {
+        return code_;
+    }
+
 private:
+    status::code_type code_;
     std::string desc_;
 };
 
+inline std::string status::message() const
+{
+    if (ok()) {
+        return std::string();
+    }
+    std::string msg = action_ ? action_ : "unknown error";
+    if (!name_.empty()) {
+        msg += " \"" + name_ + "\"";
+    }
+    ssize_t size;
+    if (loc_id_ >= 0 && H5Iis_valid(loc_id_) > 0 && (size = H5Iget_name(loc_id_, NULL, 0)) > 0) {
+        std::vector<char> buffer(size + 1);
+        H5Iget_name(loc_id_, &buffer[0], buffer.size());
+        msg += " at HDF5 object \"" + std::string(&buffer[0]) + "\"";
+    }
+    switch (code_) {
+        case not_found:
+            msg += ": not found";
+            break;
+        case type_mismatch:
+            msg += ": object of different type";
+            break;
+        default:
+            break;
+    }
+    return msg;
+}
+
+inline void status::raise() const
+{
+    if (!ok()) {
+        throw error(*this);
+    }
+}
+
 } // namespace h5xx
 
 #endif /* ! H5XX_ERROR_HPP */
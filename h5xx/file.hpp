@@ -15,10 +15,12 @@
 #define H5XX_FILE_HPP
 
 #include <h5xx/hdf5_compat.hpp>
+#include <h5xx/driver/trace.hpp>
 #include <h5xx/error.hpp>
 #include <h5xx/utility.hpp>
 
 #include <boost/lexical_cast.hpp>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -37,6 +39,208 @@ inline htri_t is_hdf5_file(std::string const& filename)
     } H5E_END_TRY
 }
 
+namespace detail {
+namespace write_behind {
+
+/** driver properties stored in the file access property list */
+struct fapl_type
+{
+    size_t segment_size;
+    unsigned int queue_depth;
+};
+
+typedef hid_t (*driver_id_function)();
+
+/**
+ * Registration function of the write-behind driver, which is installed by
+ * h5xx/driver/write_behind.hpp; NULL if the driver is not available.
+ */
+inline driver_id_function& installed_driver()
+{
+    static driver_id_function driver_id = 0;
+    return driver_id;
+}
+
+} // namespace write_behind
+} // namespace detail
+
+/**
+ * File creation and access options that tune the on-disk layout of a file and
+ * the I/O behaviour of the HDF5 library. Members with value zero (or false)
+ * leave the respective library default untouched.
+ *
+ * The file space strategy is a creation property and takes effect only if the
+ * file is newly created. Objects are written in the earliest possible file
+ * format by default; raising libver_low to H5F_LIBVER_LATEST enables compact
+ * and indexed link storage in groups and faster chunk indices for datasets
+ * with unlimited dimensions, at the expense of backward compatibility. Page
+ * buffering requires a file with paged aggregation, opening any other file
+ * fails if page_buffer_size is non-zero.
+ *
+ * Direct I/O bypasses the page cache of the operating system, which avoids
+ * evicting the working set of an application upon writing large files. It
+ * requires an HDF5 library built with the direct virtual file driver
+ * (H5_HAVE_DIRECT). Unless an alignment is given explicitly, objects of at
+ * least one block are aligned to the file system block size. Transfers from
+ * or to unaligned memory are staged by the driver through its copy buffer;
+ * containers with h5xx::page_aligned_allocator avoid the extra copy.
+ *
+ * Write-behind buffering collects writes in memory segments, merging
+ * adjacent small writes, and writes full segments to disk from a background
+ * thread. This turns metadata-heavy write patterns into a few large
+ * sequential writes. It is incompatible with SWMR access and direct I/O. The
+ * driver uses POSIX file I/O and is available only if the program includes
+ * h5xx/driver/write_behind.hpp.
+ *
+ * Tracing records all reads and writes of the file, with their sizes and
+ * latencies, in an h5xx::io_trace collector; the I/O itself is performed by
+ * the driver selected by the other options.
+ */
+struct file_options
+{
+    /** align objects of at least alignment_threshold bytes to multiples of alignment bytes, e.g., stripe size */
+    hsize_t alignment;
+    hsize_t alignment_threshold;
+
+    /** minimum size of metadata block allocations, small metadata writes are aggregated therein */
+    hsize_t meta_block_size;
+
+    /** maximum size of the data sieve buffer for partial I/O on contiguous datasets */
+    size_t sieve_buf_size;
+
+    /** use paged aggregation as file space strategy, optionally with the given page size (ignored otherwise) */
+    bool paged_aggregation;
+    hsize_t page_size;
+
+    /** size of the page buffer and the minimal percentages reserved for metadata and raw data pages */
+    size_t page_buffer_size;
+    unsigned int page_buffer_min_meta_perc;
+    unsigned int page_buffer_min_raw_perc;
+
+    /** bounds of the library versions used for creating objects, i.e., the file format */
+    H5F_libver_t libver_low;
+    H5F_libver_t libver_high;
+
+    /** use the direct I/O driver with given memory alignment, file system block size and copy buffer size */
+    bool direct_io;
+    size_t direct_alignment;
+    size_t direct_block_size;
+    size_t direct_copy_buffer_size;
+
+    /** buffer writes in segments of given size, at most write_behind_queue_depth of them are pending */
+    bool write_behind;
+    size_t write_behind_segment_size;
+    unsigned int write_behind_queue_depth;
+
+    /** record file operations in the given collector, which must outlive the file */
+    io_trace* trace;
+
+    file_options()
+      : alignment(0), alignment_threshold(1)
+      , meta_block_size(0)
+      , sieve_buf_size(0)
+      , paged_aggregation(false), page_size(0)
+      , page_buffer_size(0), page_buffer_min_meta_perc(0), page_buffer_min_raw_perc(0)
+      , libver_low(H5F_LIBVER_EARLIEST), libver_high(H5F_LIBVER_LATEST)
+      , direct_io(false), direct_alignment(4096), direct_block_size(4096), direct_copy_buffer_size(16 << 20)
+      , write_behind(false), write_behind_segment_size(4 << 20), write_behind_queue_depth(4)
+      , trace(0)
+    {}
+
+    /** returns true if any of the file creation properties deviates from the default */
+    bool has_creation_properties() const
+    {
+        return paged_aggregation;  // page_size is ignored otherwise
+    }
+
+    /** returns true if any of the file access properties deviates from the default */
+    bool has_access_properties() const
+    {
+        return alignment > 0 || meta_block_size > 0 || sieve_buf_size > 0 || page_buffer_size > 0
+            || libver_low != H5F_LIBVER_EARLIEST || libver_high != H5F_LIBVER_LATEST || direct_io || write_behind || trace;
+    }
+
+    /** set file creation properties for given property list */
+    void set_creation(hid_t fcpl) const;
+
+    /** set file access properties for given property list */
+    void set_access(hid_t fapl) const;
+};
+
+inline void file_options::set_creation(hid_t fcpl) const
+{
+    bool err = false;
+    if (paged_aggregation) {
+#if H5_VERSION_GE(1,10,1)
+        err |= H5Pset_file_space_strategy(fcpl, H5F_FSPACE_STRATEGY_PAGE, 0, 1) < 0;
+        if (page_size > 0) {
+            err |= H5Pset_file_space_page_size(fcpl, page_size) < 0;
+        }
+#else
+        throw error("paged aggregation of file space requires HDF5 ≥ 1.10.1");
+#endif
+    }
+    if (err) {
+        throw error("setting file creation properties failed");
+    }
+}
+
+inline void file_options::set_access(hid_t fapl) const
+{
+    if (write_behind && direct_io) {
+        throw error("direct I/O and write-behind buffering are mutually exclusive");
+    }
+    if (write_behind && !detail::write_behind::installed_driver()) {
+        throw error("write-behind buffering requires h5xx/driver/write_behind.hpp and a POSIX system");
+    }
+
+    bool err = false;
+    if (alignment > 0) {
+        err |= H5Pset_alignment(fapl, alignment_threshold, alignment) < 0;
+    }
+    if (meta_block_size > 0) {
+        err |= H5Pset_meta_block_size(fapl, meta_block_size) < 0;
+    }
+    if (sieve_buf_size > 0) {
+        err |= H5Pset_sieve_buf_size(fapl, sieve_buf_size) < 0;
+    }
+    if (page_buffer_size > 0) {
+#if H5_VERSION_GE(1,10,1)
+        err |= H5Pset_page_buffer_size(fapl, page_buffer_size, page_buffer_min_meta_perc, page_buffer_min_raw_perc) < 0;
+#else
+        throw error("page buffering requires HDF5 ≥ 1.10.1");
+#endif
+    }
+    if (libver_low != H5F_LIBVER_EARLIEST || libver_high != H5F_LIBVER_LATEST) {
+        err |= H5Pset_libver_bounds(fapl, libver_low, libver_high) < 0;
+    }
+    if (direct_io) {
+#ifdef H5_HAVE_DIRECT
+        err |= H5Pset_fapl_direct(fapl, direct_alignment, direct_block_size, direct_copy_buffer_size) < 0;
+        if (alignment == 0) {
+            err |= H5Pset_alignment(fapl, std::max<hsize_t>(alignment_threshold, direct_block_size), direct_block_size) < 0;
+        }
+#else
+        throw error("direct I/O requires an HDF5 library with the direct virtual file driver");
+#endif
+    }
+    if (write_behind) {
+        detail::write_behind::fapl_type config = { write_behind_segment_size, write_behind_queue_depth };
+        err |= H5Pset_driver(fapl, detail::write_behind::installed_driver()(), &config) < 0;
+    }
+    if (trace && !err) {
+        // the underlying driver is opened with a copy of the access properties
+        detail::trace::fapl_type config = { H5Pcopy(fapl), trace };
+        err |= config.under_fapl < 0 || H5Pset_driver(fapl, detail::trace::driver_id(), &config) < 0;
+        if (config.under_fapl >= 0) {
+            H5Pclose(config.under_fapl);
+        }
+    }
+    if (err) {
+        throw error("setting file access properties failed");
+    }
+}
+
 /**
  *  Represent HDF5 file. Instances of the class cannot be copied.
  *
@@ -46,10 +250,25 @@ inline htri_t is_hdf5_file(std::string const& filename)
  *      file::out      write access, append to existing file
  *      file::trunc    write access, truncate existing file
  *      file::excl     write access, file must not exist
+ *      file::swmr_write  single-writer/multiple-reader (SWMR) write access
+ *      file::swmr_read   SWMR read access, file is read-only
  *
  *  The flags may be combined by bitwise OR. Read access is always granted by
  *  the HDF5 library, so file::in may be omitted. The flags file::trunc and
  *  file::excl are mutually exclusive and imply file::out.
+ *
+ *  SWMR write access implies file::out and the latest file format (see
+ *  file_options::libver_low), which is enabled implicitly. Alternatively, a
+ *  writer opens or creates the file in the latest format, creates all
+ *  datasets, and then switches to SWMR mode with file::start_swmr_write().
+ *  Readers opened with
+ *  file::swmr_read see new data after calling dataset::refresh(), which
+ *  becomes visible once the writer has called dataset::flush() or
+ *  file::flush(). In SWMR mode, the writer may only extend existing
+ *  chunked datasets (see dataset::set_extent()) and write to them.
+ *
+ *  Creation and access properties of the file may be tuned by passing an
+ *  instance of h5xx::file_options upon opening.
  */
 class file
 {
@@ -60,6 +279,8 @@ public:
       , out = 0x0001u       /* H5F_ACC_RDWR open for read and write    */
       , trunc = 0x0002u     /* H5F_ACC_TRUNC overwrite existing files   */
       , excl = 0x0004u      /* H5F_ACC_EXCL fail if file already exists*/
+      , swmr_write = 0x0020u /* H5F_ACC_SWMR_WRITE single writer, multiple readers */
+      , swmr_read = 0x0040u /* H5F_ACC_SWMR_READ read while a writer appends */
     };
 
     /** default constructor */
@@ -68,6 +289,10 @@ public:
     /** open file upon construction */
     explicit file(std::string const& filename, unsigned mode = in | out);
 
+    /** open file with given creation and access options upon construction */
+    // --- default arguments require mode to be the last argument
+    explicit file(std::string const& filename, file_options const& options, unsigned mode = in | out);
+
 #ifdef H5XX_USE_MPI
     // --- default arguments require mode to be the last argument
     explicit file(std::string const& filename, MPI_Comm comm, MPI_Info info, unsigned mode = in | out);
@@ -108,6 +333,9 @@ public:
     /** open HDF5 file in specified mode */
     void open(std::string const& filename, unsigned mode = in | out);
 
+    /** open HDF5 file in specified mode using the given creation and access options */
+    void open(std::string const& filename, file_options const& options, unsigned mode = in | out);
+
     /** close HDF5 file
      *
      *  If strict is true, throw h5xx::error if open HDF5 objects are
@@ -118,6 +346,9 @@ public:
     /** flush all buffers associated with the file to disk */
     void flush() const;
 
+    /** enable SWMR write access for a file that is opened for writing */
+    void start_swmr_write();
+
     /** return filename on disk */
     std::string name() const;
 
@@ -125,7 +356,7 @@ private:
     /** HDF5 object ID */
     hid_t hid_;
 
-    /** file access property list ID, required for MPI parallel functionality */
+    /** file access property list ID, required for MPI parallel functionality and file options */
     hid_t plid_;
 
     template <typename h5xxObject>
@@ -138,6 +369,12 @@ inline file::file(std::string const& filename, unsigned mode)
     open(filename, mode);
 }
 
+inline file::file(std::string const& filename, file_options const& options, unsigned mode)
+  : hid_(-1),plid_(H5P_DEFAULT)
+{
+    open(filename, options, mode);
+}
+
 #ifdef H5XX_USE_MPI
 inline file::file(std::string const& filename, MPI_Comm comm, MPI_Info info, unsigned mode)
   : hid_(-1),plid_(H5P_DEFAULT)
@@ -164,10 +401,19 @@ inline file & file::operator=(file other)
 
 inline file::~file()
 {
-    close();
+    // destructors must not throw, a failure cannot be reported
+    try {
+        close();
+    }
+    catch (error const&) {}
 }
 
 inline void file::open(std::string const& filename, unsigned mode)
+{
+    open(filename, file_options(), mode);
+}
+
+inline void file::open(std::string const& filename, file_options const& options, unsigned mode)
 {
     // check that object is not yet in use
     if (hid_ >= 0) {
@@ -175,34 +421,96 @@ inline void file::open(std::string const& filename, unsigned mode)
     }
 
     // check for conflicting combination of opening flags
-    if ((mode & trunc) && (mode & excl)) {
+    if (((mode & trunc) && (mode & excl))
+     || ((mode & swmr_read) && (mode & (out | trunc | excl | swmr_write)))) {
         throw error("h5xx::file: conflicting opening mode: " + boost::lexical_cast<std::string>(mode));
     }
+    if ((mode & (swmr_write | swmr_read)) && options.write_behind) {
+        throw error("h5xx::file: SWMR access is not supported with write-behind buffering");
+    }
 
-    htri_t is_hdf5 = is_hdf5_file(filename);
-    if (is_hdf5 >= 0 && !(mode & trunc)) {
-        // file exists and may be valid HDF5, but shall not be truncated
-        if (mode & excl) {
-            throw error("refuse to overwrite existing HDF5 file: " + filename);
+    file_options opts(options);
+    if (mode & (swmr_write | swmr_read)) {
+#if H5_VERSION_GE(1,10,0)
+        if (mode & swmr_write) {
+            mode |= out;
+            if (opts.libver_low == H5F_LIBVER_EARLIEST) {
+                opts.libver_low = H5F_LIBVER_LATEST;    // required by SWMR
+            }
         }
-        else { // open file, either to append or read-only
-            if (is_hdf5 == 0) {
-                throw error("not a valid HDF5 file: " + filename);
+#else
+        throw error("SWMR access requires HDF5 ≥ 1.10");
+#endif
+    }
+
+    // amend a copy of the file access property list, which may carry MPI
+    // settings already; the copy replaces plid_ only if opening succeeds
+    hid_t fapl = plid_;
+    if (opts.has_access_properties()) {
+        fapl = (plid_ == H5P_DEFAULT) ? H5Pcreate(H5P_FILE_ACCESS) : H5Pcopy(plid_);
+        if (fapl < 0) {
+            throw error("creating file access property list failed");
+        }
+    }
+
+    try {
+        if (fapl != plid_) {
+            opts.set_access(fapl);
+        }
+
+        htri_t is_hdf5 = is_hdf5_file(filename);
+        if (is_hdf5 >= 0 && !(mode & trunc)) {
+            // file exists and may be valid HDF5, but shall not be truncated
+            if (mode & excl) {
+                throw error("refuse to overwrite existing HDF5 file: " + filename);
+            }
+            else { // open file, either to append or read-only
+                if (is_hdf5 == 0) {
+                    throw error("not a valid HDF5 file: " + filename);
+                }
+                // use that "in", "out", and the SWMR flags are equal to H5F_ACC_RDONLY, H5F_ACC_RDWR,
+                // H5F_ACC_SWMR_WRITE, and H5F_ACC_SWMR_READ, resp.
+                hid_ = H5Fopen(filename.c_str(), mode & (in | out | swmr_write | swmr_read), fapl);
+            }
+        }
+        else {
+            // file does not exist (or other error), or it exists, but shall be truncated
+            if (!(mode & (out | trunc | excl))) { // read-only
+                throw error("read-only access to non-existing HDF5 file: " + filename);
             }
-            // use that "in" and "out" are equal to H5F_ACC_RDONLY and H5F_ACC_RDWR, resp.
-            hid_ = H5Fopen(filename.c_str(), mode & (in | out), plid_);
+            // create new file
+            hid_t fcpl = H5P_DEFAULT;
+            if (opts.has_creation_properties()) {
+                fcpl = H5Pcreate(H5P_FILE_CREATE);
+                try {
+                    opts.set_creation(fcpl);
+                }
+                catch (...) {
+                    H5Pclose(fcpl);
+                    throw;
+                }
+            }
+            hid_ = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC | (mode & swmr_write), fcpl, fapl);
+            if (fcpl != H5P_DEFAULT) {
+                H5Pclose(fcpl);
+            }
+        }
+        if (hid_ < 0) {
+            throw error("opening or creation of HDF5 file \"" + filename + "\" failed");
         }
     }
-    else {
-        // file does not exist (or other error), or it exists, but shall be truncated
-        if (mode == in) { // read-only
-            throw error("read-only access to non-existing HDF5 file: " + filename);
+    catch (...) {
+        if (fapl != plid_) {
+            H5Pclose(fapl);
         }
-        // create new file
-        hid_ = H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, plid_);
+        throw;
     }
-    if (hid_ < 0) {
-        throw error("opening or creation of HDF5 file \"" + filename + "\" failed");
+
+    if (fapl != plid_) {
+        if (plid_ != H5P_DEFAULT) {
+            H5Pclose(plid_);
+        }
+        plid_ = fapl;
     }
 }
 
@@ -216,6 +524,17 @@ inline void file::flush() const
     }
 }
 
+inline void file::start_swmr_write()
+{
+#if H5_VERSION_GE(1,10,0)
+    if (H5Fstart_swmr_write(hid_) < 0) {
+        throw error("enabling SWMR write access to HDF5 file: " + name());
+    }
+#else
+    throw error("SWMR access requires HDF5 ≥ 1.10");
+#endif
+}
+
 inline void file::close(bool strict)
 {
     if (hid_ < 0) {
@@ -234,7 +553,7 @@ inline void file::close(bool strict)
         throw error("closing HDF5 file: " + name() +
                     ", file ID: " + boost::lexical_cast<std::string>(hid_));
     }
-    plid_ = -1;
+    plid_ = H5P_DEFAULT;
     hid_ = -1;
 }
 
@@ -15,18 +15,92 @@
 #ifndef H5XX_GROUP_HPP
 #define H5XX_GROUP_HPP
 
+#include <h5xx/attribute/container.hpp>
+#include <h5xx/attribute/utility.hpp>
 #include <h5xx/file.hpp>
 #include <h5xx/dataset.hpp>
 #include <h5xx/utility.hpp>
 #include <h5xx/error.hpp>
 #include <h5xx/property.hpp>
 
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace h5xx {
 
 // forward declaration
 template <typename h5xxObject>
 class container;
 
+/**
+ * Creation options of an HDF5 group, controlling the storage of its links
+ * and attributes.
+ * Members with value zero (or false) leave the respective library default
+ * untouched.
+ *
+ * Compact and dense (indexed) link storage and the tracking of the link
+ * creation order require a file format of at least HDF5 1.8, see
+ * file_options::libver_low; groups in the earliest format use symbol tables.
+ */
+struct group_options
+{
+    /** switch from compact to dense link storage above max_compact links, and back below min_dense links */
+    unsigned int max_compact;
+    unsigned int min_dense;
+
+    /** estimated number of links and average length of link names, used for sizing the object header */
+    unsigned int est_num_entries;
+    unsigned int est_name_len;
+
+    /** track the creation order of links, optionally with an index on it */
+    bool track_order;
+    bool index_order;
+
+    /** switch from compact to dense attribute storage above attr_max_compact attributes, and back below attr_min_dense */
+    unsigned int attr_max_compact;
+    unsigned int attr_min_dense;
+
+    /** track the creation order of attributes, optionally with an index on it */
+    bool attr_track_order;
+    bool attr_index_order;
+
+    group_options()
+      : max_compact(0), min_dense(0)
+      , est_num_entries(0), est_name_len(0)
+      , track_order(false), index_order(false)
+      , attr_max_compact(0), attr_min_dense(0)
+      , attr_track_order(false), attr_index_order(false)
+    {}
+
+    /** set group creation properties for given property list */
+    void set_creation(hid_t gcpl) const;
+};
+
+inline void group_options::set_creation(hid_t gcpl) const
+{
+    bool err = false;
+    if (max_compact > 0 || min_dense > 0) {
+        unsigned int max_compact_ = max_compact, min_dense_ = min_dense;
+        H5Pget_link_phase_change(gcpl, max_compact > 0 ? NULL : &max_compact_, min_dense > 0 ? NULL : &min_dense_);
+        err |= H5Pset_link_phase_change(gcpl, max_compact_, min_dense_) < 0;
+    }
+    if (est_num_entries > 0 || est_name_len > 0) {
+        unsigned int est_num_entries_ = est_num_entries, est_name_len_ = est_name_len;
+        H5Pget_est_link_info(gcpl, est_num_entries > 0 ? NULL : &est_num_entries_, est_name_len > 0 ? NULL : &est_name_len_);
+        err |= H5Pset_est_link_info(gcpl, est_num_entries_, est_name_len_) < 0;
+    }
+    if (track_order || index_order) {
+        unsigned int flags = H5P_CRT_ORDER_TRACKED | (index_order ? H5P_CRT_ORDER_INDEXED : 0);
+        err |= H5Pset_link_creation_order(gcpl, flags) < 0;
+    }
+    err |= !detail::set_attribute_storage(gcpl, attr_max_compact, attr_min_dense, attr_track_order, attr_index_order);
+    if (err) {
+        throw error("setting group creation properties failed");
+    }
+}
+
 // this class is meant to replace the H5::Group class
 class group
 {
@@ -37,6 +111,12 @@ public:
     /** constructor to open or generate a group in an existing superior group */
     group(group const& other, std::string const& name);
 
+    /**
+     * constructor to open or generate a group in an existing superior group,
+     * a newly generated group has the given creation options
+     */
+    group(group const& other, std::string const& name, group_options const& options);
+
     /** open root group of file */
     group(file const& f);
 
@@ -75,12 +155,16 @@ public:
     /** open handle to HDF5 group from an object's ID (called by non-default constructors) */
     void open(group const& other, std::string const& name);
 
+    /** open handle to HDF5 group, create the group with given options if it does not exist */
+    void open(group const& other, std::string const& name, group_options const& options);
+
     /** close handle to HDF5 group (called by default destructor) */
     void close();
 
     /** methods to yield container adapters */
     container<h5xx::dataset> datasets() const;
     container<h5xx::group> groups() const;
+    container<h5xx::attribute> attributes() const;
 
 private:
     /** HDF5 object ID */
@@ -153,14 +237,21 @@ public:
     };
 
 private:
-    /** move forward by one step, calls H5Literate */
+    /** move forward by one step, on first call obtains the names of all elements by H5Literate */
     bool increment_();
 
     /** pointer to parent group */
     group const* parent_ = nullptr;
 
     /**
-     * index of element in group as used by H5Literate.
+     * names of all elements of type T in the parent group, collected in a
+     * single pass over the group upon the first increment and shared between
+     * copies of the iterator
+     */
+    std::shared_ptr<std::vector<std::string> const> names_;
+
+    /**
+     * position of the current element in names_, counting from 1.
      * If stop_idx_ == -1U, iterator points past the end.
      * stop_idx_ == 0 indicates a freshly constructed iterator, which points at
      * the first element (non-empty group), or past the end (empty group).
@@ -214,6 +305,12 @@ inline group::group(group const& other, std::string const& name)
     open(other, name);
 }
 
+inline group::group(group const& other, std::string const& name, group_options const& options)
+  : hid_(-1)
+{
+    open(other, name, options);
+}
+
 inline group::group(file const& f)
 {
     hid_ = H5Gopen(f.hid(), "/", H5P_DEFAULT);
@@ -238,10 +335,18 @@ inline group& group::operator=(group other)
 
 inline group::~group()
 {
-    close();
+    // destructors must not throw, a failure cannot be reported
+    if (hid_ >= 0) {
+        H5Gclose(hid_);
+    }
 }
 
 inline void group::open(group const& other, std::string const& name)
+{
+    open(other, name, group_options());
+}
+
+inline void group::open(group const& other, std::string const& name, group_options const& options)
 {
     if (hid_ >= 0) {
         throw error("h5xx::group object is already in use");
@@ -251,9 +356,20 @@ inline void group::open(group const& other, std::string const& name)
         hid_ = H5Gopen(other.hid(), name.c_str(), H5P_DEFAULT);
     }
     else {
-        hid_t lcpl_id = H5Pcreate(H5P_LINK_CREATE);     // create group creation property list
+        hid_t lcpl_id = H5Pcreate(H5P_LINK_CREATE);     // create link creation property list
         H5Pset_create_intermediate_group(lcpl_id, 1);   // set intermediate link creation
-        hid_ = H5Gcreate(other.hid(), name.c_str(), lcpl_id, H5P_DEFAULT, H5P_DEFAULT);
+        hid_t gcpl_id = H5Pcreate(H5P_GROUP_CREATE);    // create group creation property list
+        try {
+            options.set_creation(gcpl_id);
+        }
+        catch (...) {
+            H5Pclose(gcpl_id);
+            H5Pclose(lcpl_id);
+            throw;
+        }
+        hid_ = H5Gcreate(other.hid(), name.c_str(), lcpl_id, gcpl_id, H5P_DEFAULT);
+        H5Pclose(gcpl_id);
+        H5Pclose(lcpl_id);
     }
     if (hid_ < 0){
         throw error("creating or opening group \"" + name + "\"");
@@ -274,14 +390,7 @@ inline void group::close() {
  */
 inline bool exists_group(group const& grp, std::string const& name)
 {
-    hid_t hid = grp.hid();
-    H5E_BEGIN_TRY {
-        hid = H5Gopen(hid, name.c_str(), H5P_DEFAULT);
-        if (hid > 0) {
-            H5Gclose(hid);
-        }
-    } H5E_END_TRY
-    return (hid > 0);
+    return get_object_type(grp, name) == H5O_TYPE_GROUP;
 }
 
 inline hid_t open_group(hid_t loc_id, std::string const& path)
@@ -303,6 +412,11 @@ inline container<h5xx::group> group::groups() const
     return container<h5xx::group>(*this);
 }
 
+inline container<h5xx::attribute> group::attributes() const
+{
+    return container<h5xx::attribute>(*this);
+}
+
 /*
  * implementation of adapter classes for group containers
  */
@@ -382,6 +496,7 @@ inline group_iterator<T, is_const>::group_iterator(group const& group) noexcept
 template <typename T, bool is_const>
 inline group_iterator<T, is_const>::group_iterator(group_iterator const& other) noexcept
   : parent_(other.parent_)
+  , names_(other.names_)
   , stop_idx_(other.stop_idx_)
   , name_(other.name_)
   , element_(nullptr)   // don't copy pointer to HDF5 resource
@@ -404,6 +519,7 @@ inline group_iterator<T, is_const>& group_iterator<T, is_const>::operator=(group
         }
 
         parent_ = other.parent_;
+        names_ = std::move(other.names_);
         stop_idx_ = other.stop_idx_;
         name_ = std::move(other.name_);
         element_ = other.element_;
@@ -411,6 +527,7 @@ inline group_iterator<T, is_const>& group_iterator<T, is_const>::operator=(group
         // leave behind default constructed object,
         // destructor must not release *other.element_
         other.parent_ = nullptr;
+        other.names_.reset();
         other.stop_idx_ = -1U;
         other.name_ = std::string();
         other.element_ = nullptr;
@@ -534,52 +651,64 @@ inline bool group_iterator<T, is_const>::increment_()
         return false;
     }
 
-    herr_t retval = H5Literate(
-        parent_->hid(), H5_INDEX_NAME, H5_ITER_INC, &stop_idx_
-      , detail::find_name_of_type<T>, &name_
-    );
+    // collect the names of all elements of type T in a single pass
+    if (!names_) {
+        std::vector<std::string> names;
+        std::pair<std::vector<std::string>*, std::string> data(&names, std::string());
+        hsize_t idx = 0;
+        if (H5Literate(parent_->hid(), H5_INDEX_NAME, H5_ITER_INC, &idx, detail::find_name_of_type<T>, &data) < 0) {
+            throw error("Cannot get object info of " + data.second);
+        }
+        names_ = std::make_shared<std::vector<std::string> const>(std::move(names));
+    }
 
-    // evaluate return code
-    if(retval == 0) {       // no element of type T was found
+    if (stop_idx_ == -1U || stop_idx_ >= names_->size()) {
         stop_idx_ = -1U;    // set iterator to past-the-end iterator
         name_ = std::string();
+        return false;
     }
 
-    return retval > 0;      // everything went fine
+    name_ = (*names_)[stop_idx_++];
+    return true;
 }
 
 namespace detail {
 
 /**
- * determine whether a given HDF5 object has a given type and return its name
+ * determine whether a given HDF5 object has a given type and append its name
+ * to the list passed in op_data; only the basic object info is queried
  *
- * @return code: success: > 0, wrong type: 0, error: < 0
+ * @return code: success: 0, error: < 0
  */
 template <H5O_type_t type>
 herr_t find_name_of_type_impl(hid_t g_id, char const* name, H5L_info_t const* info, void* op_data)
 {
-    H5O_info_t obj_info;
+    typedef std::pair<std::vector<std::string>*, std::string> data_type;
+    data_type* data = reinterpret_cast<data_type*>(op_data);
 
     /** returns non-negative upon success, negative if failed */
+#if H5_VERSION_GE(1,12,0)
+    H5O_info2_t obj_info;
+    herr_t retval = H5Oget_info_by_name3(g_id, name, &obj_info, H5O_INFO_BASIC, H5P_DEFAULT);
+#elif H5_VERSION_GE(1,10,3)
+    H5O_info_t obj_info;
+    herr_t retval = H5Oget_info_by_name2(g_id, name, &obj_info, H5O_INFO_BASIC, H5P_DEFAULT);
+#else
+    H5O_info_t obj_info;
     herr_t retval = H5Oget_info_by_name(g_id, name, &obj_info, H5P_DEFAULT);
+#endif
 
-    /** check retval */
-    if(retval >= 0) {
-        /** filter for given HDF5 type */
-        if(obj_info.type == type) {
-            std::string* str_ptr = reinterpret_cast<std::string*>(op_data);
-            *str_ptr = name;
-            retval++;   // ensure retval is > 0 for short-circuit success
-        }
-        else {          // if element name was not 'type', continue iteration
-            retval = 0;
-        }
-    }
-    else {
-        throw error("Cannot get object info of "+std::string(name));
+    /** check retval, exceptions must not propagate through the HDF5 library */
+    if(retval < 0) {
+        data->second = name;
+        return retval;
     }
 
-    return retval;
+    /** filter for given HDF5 type */
+    if(obj_info.type == type) {
+        data->first->push_back(name);
+    }
+    return 0;
 }
 
 template <>
@@ -20,6 +20,7 @@ namespace h5xx {
     enum { compression_level = 6 };
 }
 
+#include <h5xx/allocator.hpp>
 #include <h5xx/attribute.hpp>
 #include <h5xx/ctype.hpp>
 #include <h5xx/dataset.hpp>
@@ -28,6 +29,10 @@ namespace h5xx {
 #include <h5xx/slice.hpp>
 #include <h5xx/file.hpp>
 #include <h5xx/group.hpp>
+#include <h5xx/instrument.hpp>
+#include <h5xx/trace.hpp>
+#include <h5xx/try.hpp>
 #include <h5xx/utility.hpp>
+#include <h5xx/visit.hpp>
 
 #endif /* ! H5XX_HPP */
@@ -0,0 +1,262 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_INSTRUMENT_HPP
+#define H5XX_INSTRUMENT_HPP
+
+#include <h5xx/hdf5_compat.hpp>
+#include <h5xx/trace.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace h5xx {
+
+/**
+ * Instrumentation of dataset::read/write and attribute::read/write, the
+ * choke points of all typed read and write functions, and of the transfers
+ * of dataset_batch and read_all_attributes().
+ *
+ * An instrument::sink installed at runtime with set_sink() is informed of
+ * each successful transfer. No sink is installed by default, then the cost
+ * of instrumentation is a single atomic load per transfer. With a recorder,
+ * calls, bytes and wall time are accumulated per object path in the
+ * process-wide instrument::registry:
+ *
+ *     h5xx::instrument::recorder recorder;
+ *     h5xx::instrument::set_sink(&recorder);
+ */
+namespace instrument {
+
+/** a completed transfer, the IDs are valid only during sink::record() */
+struct transfer
+{
+    hid_t object_id;
+    bool write;
+    hid_t mem_type_id;
+    hid_t mem_space_id;
+    hid_t file_space_id;
+    /** wall time in seconds */
+    double seconds;
+};
+
+/** receiver of the transfers, it must not be destroyed while installed */
+class sink
+{
+public:
+    virtual ~sink() {}
+
+    /** called after each successful transfer, possibly from several threads */
+    virtual void record(transfer const& t) = 0;
+};
+
+} // namespace instrument
+
+namespace detail {
+
+inline std::atomic<instrument::sink*>& installed_sink()
+{
+    static std::atomic<instrument::sink*> s(0);
+    return s;
+}
+
+} // namespace detail
+
+namespace instrument {
+
+/** install the given sink, or none if NULL; returns the previously installed sink */
+inline sink* set_sink(sink* s)
+{
+    return h5xx::detail::installed_sink().exchange(s);
+}
+
+/** the installed sink, or NULL */
+inline sink* get_sink()
+{
+    return h5xx::detail::installed_sink().load(std::memory_order_acquire);
+}
+
+/** number of bytes in memory: selected elements times size of the memory type */
+inline boost::uint64_t bytes(transfer const& t);
+
+/** path of the object, attributes are suffixed by '@' and their name */
+inline std::string path(transfer const& t);
+
+/**
+ * Process-wide statistics per dataset and attribute, keyed by the path of the
+ * object; attributes are named "path@attribute". Thread-safe.
+ */
+class registry
+{
+public:
+    struct entry
+    {
+        io_counter read;
+        io_counter write;
+    };
+
+    typedef std::map<std::string, entry> map_type;
+
+    static registry& get()
+    {
+        static registry instance;
+        return instance;
+    }
+
+    void record(std::string const& path, bool write, boost::uint64_t bytes, double seconds)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entry& e = entries_[path];
+        (write ? e.write : e.read).add(bytes, seconds);
+    }
+
+    /** copy of the statistics, for polling */
+    map_type snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_;
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+    }
+
+    /** write statistics of all objects as JSON object */
+    void dump(std::ostream& os) const;
+
+private:
+    registry() {}
+    registry(registry const&) = delete;
+    registry& operator=(registry const&) = delete;
+
+    mutable std::mutex mutex_;
+    map_type entries_;
+};
+
+inline void registry::dump(std::ostream& os) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    os << "{";
+    for (map_type::const_iterator it = entries_.begin(); it != entries_.end(); ++it) {
+        os << (it != entries_.begin() ? ",\n  " : "\n  ");
+        detail::write_json_string(os, it->first);
+        os << ": {\"read\": ";
+        detail::write_json(os, it->second.read);
+        os << ", \"write\": ";
+        detail::write_json(os, it->second.write);
+        os << "}";
+    }
+    os << "\n}\n";
+}
+
+/** records into instrument::registry */
+class recorder
+  : public sink
+{
+public:
+    void record(transfer const& t)
+    {
+        registry::get().record(path(t), t.write, bytes(t), t.seconds);
+    }
+};
+
+inline boost::uint64_t bytes(transfer const& t)
+{
+    hssize_t npoints = -1;
+    if (t.mem_space_id != H5S_ALL) {
+        npoints = H5Sget_select_npoints(t.mem_space_id);
+    }
+    else if (t.file_space_id != H5S_ALL) {
+        npoints = H5Sget_select_npoints(t.file_space_id);
+    }
+    else {
+        hid_t space_id = H5Iget_type(t.object_id) == H5I_ATTR ? H5Aget_space(t.object_id) : H5Dget_space(t.object_id);
+        if (space_id >= 0) {
+            npoints = H5Sget_select_npoints(space_id);
+            H5Sclose(space_id);
+        }
+    }
+    size_t size = H5Tget_size(t.mem_type_id);
+    return npoints > 0 ? static_cast<boost::uint64_t>(npoints) * size : 0;
+}
+
+inline std::string path(transfer const& t)
+{
+    std::vector<char> buffer(256);
+    ssize_t size = H5Iget_name(t.object_id, &buffer[0], buffer.size());
+    if (size >= static_cast<ssize_t>(buffer.size())) {
+        buffer.resize(size + 1);
+        size = H5Iget_name(t.object_id, &buffer[0], buffer.size());
+    }
+    std::string path(&buffer[0], size > 0 ? size : 0);
+    if (H5Iget_type(t.object_id) == H5I_ATTR) {
+        size = H5Aget_name(t.object_id, buffer.size(), &buffer[0]);
+        if (size >= static_cast<ssize_t>(buffer.size())) {
+            buffer.resize(size + 1);
+            size = H5Aget_name(t.object_id, buffer.size(), &buffer[0]);
+        }
+        path += '@';
+        path.append(&buffer[0], size > 0 ? size : 0);
+    }
+    return path;
+}
+
+} // namespace instrument
+
+namespace detail {
+
+/**
+ * Measures a transfer if a sink is installed: constructed before the
+ * transfer, done() is called after it succeeded.
+ */
+class instrument_probe
+{
+public:
+    instrument_probe(hid_t object_id, bool write, hid_t mem_type_id, hid_t mem_space_id, hid_t file_space_id)
+      : sink_(instrument::get_sink())
+    {
+        if (sink_) {
+            transfer_.object_id = object_id;
+            transfer_.write = write;
+            transfer_.mem_type_id = mem_type_id;
+            transfer_.mem_space_id = mem_space_id;
+            transfer_.file_space_id = file_space_id;
+            start_ = clock::now();
+        }
+    }
+
+    /** report the transfer, its time is divided by 'share' if it was one of several in a joint call */
+    void done(unsigned int share = 1)
+    {
+        if (sink_) {
+            transfer_.seconds = std::chrono::duration<double>(clock::now() - start_).count() / share;
+            sink_->record(transfer_);
+        }
+    }
+
+private:
+    typedef std::chrono::steady_clock clock;
+
+    instrument::sink* sink_;
+    instrument::transfer transfer_;
+    clock::time_point start_;
+};
+
+} // namespace detail
+} // namespace h5xx
+
+#endif /* ! H5XX_INSTRUMENT_HPP */
@@ -12,7 +12,9 @@
 #ifndef H5XX_POLICY_HPP
 #define H5XX_POLICY_HPP
 
+#include <h5xx/policy/conversion.hpp>
 #include <h5xx/policy/filter.hpp>
+#include <h5xx/policy/ragged.hpp>
 #include <h5xx/policy/storage.hpp>
 #include <h5xx/policy/string.hpp>
 
@@ -0,0 +1,43 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_POLICY_CONVERSION_HPP
+#define H5XX_POLICY_CONVERSION_HPP
+
+namespace h5xx {
+namespace policy {
+namespace conversion {
+
+/**
+ * Conversion of the file type to the memory type is left to the HDF5
+ * library. This is the behaviour of read_dataset() without policy.
+ */
+struct hdf5 {};
+
+/**
+ * The file type must match the memory type exactly, otherwise reading throws
+ * h5xx::error. Guards against unnoticed, slow conversions.
+ */
+struct strict {};
+
+/**
+ * Numeric conversions between IEEE floating-point types and between integer
+ * types, including byte swapping, are performed by h5xx in tight loops
+ * after a raw read, which the compiler vectorises. Out-of-range integers
+ * saturate as with the HDF5 library. Other conversions are left to the HDF5
+ * library.
+ */
+struct kernel {};
+
+} // namespace conversion
+} // namespace policy
+} // namespace h5xx
+
+#endif /* ! H5XX_POLICY_CONVERSION_HPP */
@@ -17,7 +17,7 @@
 
 #include <h5xx/error.hpp>
 #include <h5xx/ctype.hpp>
-#include <h5xx/h5xx.hpp>
+#include <h5xx/hdf5_compat.hpp>
 
 #include <boost/type_traits.hpp>
 #include <boost/utility/enable_if.hpp>
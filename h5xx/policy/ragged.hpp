@@ -0,0 +1,36 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_POLICY_RAGGED_HPP
+#define H5XX_POLICY_RAGGED_HPP
+
+namespace h5xx {
+namespace policy {
+namespace ragged {
+
+/**
+ * Layout of ragged arrays (std::vector<std::vector<T> >): a single dataset
+ * of variable-length sequences of T. This is the default layout.
+ */
+struct vlen {};
+
+/**
+ * Layout of ragged arrays: a group holding the concatenated rows in the
+ * dataset "values" and the n+1 row boundaries in the dataset "offsets".
+ * Rows can be read individually, the values may be chunked and compressed
+ * like any other dataset.
+ */
+struct offsets {};
+
+} // namespace ragged
+} // namespace policy
+} // namespace h5xx
+
+#endif /* ! H5XX_POLICY_RAGGED_HPP */
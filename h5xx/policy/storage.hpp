@@ -22,8 +22,9 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/make_shared.hpp>
 
+#include <h5xx/attribute/utility.hpp>
 #include <h5xx/error.hpp>
-#include <h5xx/h5xx.hpp>
+#include <h5xx/hdf5_compat.hpp>
 #include <h5xx/policy/filter.hpp>
 
 
@@ -33,7 +34,7 @@ namespace storage {
 
 
 
-// --- Implementations of HDF5 storage modifier policies (fill_value, track_times) ---
+// --- Implementations of HDF5 storage modifier policies (fill_value, track_times, attribute_storage) ---
 
 /**
  * Abtract base class for storage modifier policies: Defines the interface and
@@ -101,6 +102,39 @@ private:
     bool optional;
 };
 
+/**
+ * policy class to control the storage of attributes attached to the dataset:
+ * switch from compact to dense storage above max_compact attributes, and back
+ * below min_dense attributes (zero keeps the library default); optionally,
+ * track the creation order of attributes and maintain an index on it.
+ */
+class attribute_storage
+  : public storage_modifier_base
+{
+public:
+    attribute_storage(unsigned int max_compact_, unsigned int min_dense_ = 0
+      , bool track_order_ = false, bool index_order_ = false, bool optional_ = false)
+      : max_compact(max_compact_), min_dense(min_dense_)
+      , track_order(track_order_), index_order(index_order_)
+      , optional(optional_)
+    {}
+
+    /** set attribute storage properties for given property list */
+    virtual void set_storage(hid_t plist) const
+    {
+        if (!detail::set_attribute_storage(plist, max_compact, min_dense, track_order, index_order))
+            if (!optional)
+                throw error("setting attribute storage failed");
+    }
+
+private:
+    unsigned int max_compact;
+    unsigned int min_dense;
+    bool track_order;
+    bool index_order;
+    bool optional;
+};
+
 
 
 
@@ -11,8 +11,9 @@
 #ifndef H5XX_POLICY_STRING_HPP
 #define H5XX_POLICY_STRING_HPP
 
+#include <h5xx/datatype/cache.hpp>
 #include <h5xx/error.hpp>
-#include <h5xx/h5xx.hpp>
+#include <h5xx/hdf5_compat.hpp>
 
 namespace h5xx {
 namespace policy {
@@ -22,16 +23,16 @@ struct null_terminated
 {
     enum { is_variable_length = 0 };
 
+    /** return new datatype, to be closed by the caller with H5Tclose() */
     hid_t make_type( size_t size )
     {
-       bool err = false;
-       hid_t type_id = H5Tcopy(H5T_C_S1);
-       err |= H5Tset_size(type_id, size) < 0;
-       err |= H5Tset_strpad(type_id, H5T_STR_NULLTERM) < 0;
-       if (err) {
-           throw error("creating null-terminated string datatype");
-       }
-       return type_id;
+       return detail::copy_cached_type(cached_type(size));
+    }
+
+    /** return shared datatype from the cache, to be released with detail::release_type() */
+    hid_t cached_type( size_t size )
+    {
+       return detail::cached_string_type(size, H5T_STR_NULLTERM);
     }
 
 };
@@ -40,16 +41,16 @@ struct null_padded
 {
     enum { is_variable_length = 0 };
 
+    /** return new datatype, to be closed by the caller with H5Tclose() */
     hid_t make_type( size_t size )
     {
-       bool err = false;
-       hid_t type_id = H5Tcopy(H5T_C_S1);
-       err |= H5Tset_size(type_id, size) < 0;
-       err |= H5Tset_strpad(type_id, H5T_STR_NULLPAD) < 0;
-       if (err) {
-           throw error("creating null-padded string dataspace");
-       }
-       return type_id;
+       return detail::copy_cached_type(cached_type(size));
+    }
+
+    /** return shared datatype from the cache, to be released with detail::release_type() */
+    hid_t cached_type( size_t size )
+    {
+       return detail::cached_string_type(size, H5T_STR_NULLPAD);
     }
 
 };
@@ -58,16 +59,16 @@ struct space_padded
 {
     enum { is_variable_length = 0 };
 
+    /** return new datatype, to be closed by the caller with H5Tclose() */
     hid_t make_type( size_t size )
     {
-       bool err = false;
-       hid_t type_id = H5Tcopy(H5T_C_S1);
-       err |= H5Tset_size(type_id, size) < 0;
-       err |= H5Tset_strpad(type_id, H5T_STR_SPACEPAD) < 0;
-       if (err) {
-           throw error("creating space-padded string dataspace");
-       }
-       return type_id;
+       return detail::copy_cached_type(cached_type(size));
+    }
+
+    /** return shared datatype from the cache, to be released with detail::release_type() */
+    hid_t cached_type( size_t size )
+    {
+       return detail::cached_string_type(size, H5T_STR_SPACEPAD);
     }
 
 };
@@ -76,16 +77,16 @@ struct variable_length
 {
     enum { is_variable_length = 1 };
 
-    hid_t make_type( size_t size)
+    /** return new datatype, to be closed by the caller with H5Tclose() */
+    hid_t make_type( size_t size )
+    {
+       return detail::copy_cached_type(cached_type(size));
+    }
+
+    /** return shared datatype from the cache, to be released with detail::release_type() */
+    hid_t cached_type( size_t size )
     {
-       bool err = false;
-       hid_t type_id = H5Tcopy(H5T_C_S1);
-//        err |= H5Tset_size(type_id, size) < 0;
-       err |= H5Tset_size(type_id, H5T_VARIABLE) < 0;
-       if (err) {
-           throw error("creating variable-length string dataspace");
-       }
-       return type_id;
+       return detail::cached_string_type(H5T_VARIABLE);
     }
 };
 } //namespace string
@@ -0,0 +1,275 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_TRACE_HPP
+#define H5XX_TRACE_HPP
+
+#include <h5xx/error.hpp>
+
+#include <boost/array.hpp>
+#include <boost/cstdint.hpp>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace h5xx {
+
+/**
+ * Counters of I/O operations of one kind, the latency histogram has
+ * logarithmic bins: bin 0 counts operations faster than 1µs, bin k > 0 those
+ * taking [2^(k-1), 2^k) µs, and the last bin all slower ones.
+ */
+struct io_counter
+{
+    enum { latency_bins = 24 };
+
+    boost::uint64_t calls;
+    boost::uint64_t bytes;
+    /** accumulated time in seconds */
+    double time;
+    boost::array<boost::uint64_t, latency_bins> latency;
+
+    io_counter() : calls(0), bytes(0), time(0)
+    {
+        latency.assign(0);
+    }
+
+    void add(boost::uint64_t size, double seconds)
+    {
+        ++calls;
+        bytes += size;
+        time += seconds;
+        unsigned bin = 0;
+        for (double t = seconds * 1e6; t >= 1 && bin + 1 < latency_bins; t /= 2) {
+            ++bin;
+        }
+        ++latency[bin];
+    }
+};
+
+/** reads and writes, split into file metadata and raw data */
+struct io_stats
+{
+    io_counter read_metadata;
+    io_counter read_raw;
+    io_counter write_metadata;
+    io_counter write_raw;
+
+    io_counter& select(bool write, bool raw)
+    {
+        return write ? (raw ? write_raw : write_metadata) : (raw ? read_raw : read_metadata);
+    }
+};
+
+/**
+ * Collector of the operations performed by the virtual file driver on files
+ * opened with file_options::trace, which passes all operations on to the
+ * driver that would be used otherwise.
+ *
+ * The operations are counted per file and, within the lifetime of an
+ * io_trace::scope object, additionally under the label of the scope, e.g.,
+ * the path of the dataset being written:
+ *
+ *     h5xx::io_trace trace("profile.json");
+ *     h5xx::file_options opts;
+ *     opts.trace = &trace;
+ *     h5xx::file f("data.h5", opts);
+ *     {
+ *         h5xx::io_trace::scope s("/particles/position");
+ *         write_dataset(f, "/particles/position", position);
+ *     }
+ *
+ * If an output file is given, all statistics are written in JSON format upon
+ * closing any of the traced files. The collector must outlive the files.
+ */
+class io_trace
+{
+public:
+    /** the statistics of a file and of its scopes */
+    struct file_stats
+    {
+        io_stats total;
+        std::map<std::string, io_stats> scopes;
+    };
+
+    typedef std::map<std::string, file_stats> map_type;
+
+    /** label of the current thread's operations, scopes may be nested */
+    class scope
+    {
+    public:
+        explicit scope(std::string const& label) : label_(label), outer_(current())
+        {
+            current() = &label_;
+        }
+
+        ~scope()
+        {
+            current() = outer_;
+        }
+
+        /** label of the innermost scope of the calling thread, or NULL */
+        static std::string const* label()
+        {
+            return current();
+        }
+
+    private:
+        scope(scope const&) = delete;
+        scope& operator=(scope const&) = delete;
+
+        static std::string const*& current()
+        {
+            static thread_local std::string const* label = 0;
+            return label;
+        }
+
+        std::string label_;
+        std::string const* outer_;
+    };
+
+    explicit io_trace(std::string const& output = std::string()) : output_(output) {}
+
+    /** count an operation on the given file, called by the driver */
+    void record(std::string const& filename, bool write, bool raw, boost::uint64_t size, double seconds);
+
+    /** write statistics to the output file, called by the driver upon closing a file */
+    void close_file(std::string const& filename);
+
+    /** copy of the statistics of all files */
+    map_type stats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return files_;
+    }
+
+    /** statistics of a single file, empty if the file was not traced */
+    file_stats stats(std::string const& filename) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        map_type::const_iterator it = files_.find(filename);
+        return it != files_.end() ? it->second : file_stats();
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        files_.clear();
+    }
+
+    /** write statistics of all files as JSON object */
+    void write_json(std::ostream& os) const;
+
+private:
+    io_trace(io_trace const&) = delete;
+    io_trace& operator=(io_trace const&) = delete;
+
+    std::string output_;
+    mutable std::mutex mutex_;
+    map_type files_;
+};
+
+namespace detail {
+
+inline void write_json_string(std::ostream& os, std::string const& s)
+{
+    os << '"';
+    for (std::string::const_iterator it = s.begin(); it != s.end(); ++it) {
+        unsigned char c = *it;
+        if (c == '"' || c == '\\') {
+            os << '\\' << c;
+        }
+        else if (c < 0x20) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+            os << buf;
+        }
+        else {
+            os << c;
+        }
+    }
+    os << '"';
+}
+
+inline void write_json(std::ostream& os, io_counter const& c)
+{
+    os << "{\"calls\": " << c.calls << ", \"bytes\": " << c.bytes << ", \"time\": " << c.time
+       << ", \"latency_us_log2\": [";
+    for (unsigned i = 0; i < c.latency.size(); ++i) {
+        os << (i > 0 ? ", " : "") << c.latency[i];
+    }
+    os << "]}";
+}
+
+inline void write_json(std::ostream& os, io_stats const& s)
+{
+    os << "{\"read\": {\"metadata\": ";
+    write_json(os, s.read_metadata);
+    os << ", \"raw\": ";
+    write_json(os, s.read_raw);
+    os << "}, \"write\": {\"metadata\": ";
+    write_json(os, s.write_metadata);
+    os << ", \"raw\": ";
+    write_json(os, s.write_raw);
+    os << "}}";
+}
+
+} // namespace detail
+
+inline void io_trace::record(std::string const& filename, bool write, bool raw, boost::uint64_t size, double seconds)
+{
+    std::string const* label = scope::label();
+    std::lock_guard<std::mutex> lock(mutex_);
+    file_stats& f = files_[filename];
+    f.total.select(write, raw).add(size, seconds);
+    if (label) {
+        f.scopes[*label].select(write, raw).add(size, seconds);
+    }
+}
+
+inline void io_trace::close_file(std::string const&)
+{
+    if (output_.empty()) {
+        return;
+    }
+    std::ofstream os(output_.c_str());
+    write_json(os);
+    if (!os) {
+        throw error("writing I/O trace to file \"" + output_ + "\"");
+    }
+}
+
+inline void io_trace::write_json(std::ostream& os) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    os << "{\"files\": {";
+    for (map_type::const_iterator f = files_.begin(); f != files_.end(); ++f) {
+        os << (f != files_.begin() ? ",\n  " : "\n  ");
+        detail::write_json_string(os, f->first);
+        os << ": {\"total\": ";
+        detail::write_json(os, f->second.total);
+        os << ",\n    \"scopes\": {";
+        for (std::map<std::string, io_stats>::const_iterator s = f->second.scopes.begin(); s != f->second.scopes.end(); ++s) {
+            os << (s != f->second.scopes.begin() ? ",\n      " : "\n      ");
+            detail::write_json_string(os, s->first);
+            os << ": ";
+            detail::write_json(os, s->second);
+        }
+        os << "}}";
+    }
+    os << "\n}}\n";
+}
+
+} // namespace h5xx
+
+#endif /* ! H5XX_TRACE_HPP */
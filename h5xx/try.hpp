@@ -0,0 +1,169 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_TRY_HPP
+#define H5XX_TRY_HPP
+
+#include <h5xx/attribute.hpp>
+#include <h5xx/dataset.hpp>
+#include <h5xx/error.hpp>
+#include <h5xx/group.hpp>
+#include <h5xx/hdf5_compat.hpp>
+
+#include <boost/type_traits/is_fundamental.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/utility/enable_if.hpp>
+
+#include <string>
+
+/**
+ * Non-throwing variants of opening and reading objects, for probing optional
+ * datasets, groups, and attributes in hot loops.
+ *
+ * The functions return an h5xx::status instead of throwing h5xx::error. A
+ * missing object, also below missing intermediate groups (see
+ * get_object_type()), is detected without exception, without printing of the
+ * HDF5 error stack, and without formatting a message; the latter is deferred
+ * to status::message(). Errors of the actual transfer are rare and still
+ * raised internally, they are converted to a status as well.
+ *
+ *     std::vector<double> value;
+ *     if (!try_read_dataset(group, "optional/data", value)) {
+ *         ...                 // fall back to defaults
+ *     }
+ */
+
+namespace h5xx {
+namespace detail {
+
+/** check that 'name' is an object of the expected type */
+inline status probe_object(hid_t loc_id, std::string const& name, H5O_type_t expected, char const* action)
+{
+    H5O_type_t type = get_object_type(loc_id, name);
+    if (type == H5O_TYPE_UNKNOWN) {
+        return status(status::not_found, action, name, loc_id);
+    }
+    if (type != expected) {
+        return status(status::type_mismatch, action, name, loc_id);
+    }
+    return status();
+}
+
+template <typename T>
+inline typename boost::enable_if<boost::is_fundamental<T>, void>::type
+read_into(dataset& dset, T& value)
+{
+    if (!dataspace(dset).is_scalar()) {
+        throw error(status(status::type_mismatch, "reading scalar from dataset"));
+    }
+    dset.read(ctype<T>::hid(), &value);
+}
+
+template <typename T>
+inline typename boost::enable_if<boost::is_same<T, std::string>, void>::type
+read_into(dataset& dset, T& value)
+{
+    value = read_dataset<T>(dset);
+}
+
+template <typename T>
+inline typename boost::disable_if<boost::mpl::or_<boost::is_fundamental<T>, boost::is_same<T, std::string> >, void>::type
+read_into(dataset& dset, T& value)
+{
+    read_dataset(dset, value);
+}
+
+} // namespace detail
+
+/**
+ * Open dataset 'name' of the given object into 'dset', which must not be in
+ * use. Returns status::not_found or status::type_mismatch without opening.
+ */
+template <typename h5xxObject>
+inline status try_open_dataset(h5xxObject const& object, std::string const& name, dataset& dset)
+{
+    status s = detail::probe_object(object.hid(), name, H5O_TYPE_DATASET, "opening dataset");
+    if (s) {
+        try {
+            dataset tmp(object, name);
+            swap(dset, tmp);
+        }
+        catch (error const& e) {
+            return status(e.code(), "opening dataset", name, object.hid());
+        }
+    }
+    return s;
+}
+
+/**
+ * Read dataset 'name' of the given object into 'value', which is of any type
+ * supported by read_dataset(). Scalar values are read as by read_dataset<T>().
+ */
+template <typename h5xxObject, typename T>
+inline status try_read_dataset(h5xxObject const& object, std::string const& name, T& value)
+{
+    dataset dset;
+    status s = try_open_dataset(object, name, dset);
+    if (s) {
+        try {
+            detail::read_into(dset, value);
+        }
+        catch (error const& e) {
+            return status(e.code(), "reading dataset", name, object.hid());
+        }
+    }
+    return s;
+}
+
+/**
+ * Read attribute 'name' of the given object into 'value', the type of which
+ * is any T supported by read_attribute<T>().
+ */
+template <typename h5xxObject, typename T>
+inline status try_read_attribute(h5xxObject const& object, std::string const& name, T& value)
+{
+    htri_t exists;
+    H5E_BEGIN_TRY {
+        exists = H5Aexists(object.hid(), name.c_str());
+    } H5E_END_TRY
+    if (exists <= 0) {
+        return status(exists < 0 ? status::failure : status::not_found, "reading attribute", name, object.hid());
+    }
+    try {
+        value = read_attribute<T>(object, name);
+    }
+    catch (error const& e) {
+        return status(e.code(), "reading attribute", name, object.hid());
+    }
+    return status();
+}
+
+/**
+ * Open existing group 'name' below 'parent' into 'grp', which must not be in
+ * use. In contrast to group::open(), a missing group is not created.
+ */
+inline status try_open_group(group const& parent, std::string const& name, group& grp)
+{
+    status s = detail::probe_object(parent.hid(), name, H5O_TYPE_GROUP, "opening group");
+    if (s) {
+        try {
+            grp.open(parent, name);
+        }
+        catch (error const& e) {
+            return status(e.code(), "opening group", name, parent.hid());
+        }
+    }
+    return s;
+}
+
+} // namespace h5xx
+
+#endif /* ! H5XX_TRY_HPP */
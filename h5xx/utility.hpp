@@ -361,6 +361,104 @@ inline bool is_valid(hid_t hid)
 #endif /* H5_VERSION_LE(1,8,13) */
 }
 
+/**
+ * Return true if all links along 'path' relative to the given object exist.
+ *
+ * The path components are checked one by one with H5Lexists, so that a
+ * missing intermediate group or a dataset in the middle of the path yields
+ * false instead of an error. Neither the final object nor any group along
+ * the path is opened. The root "/" and "." always exist, components "." and
+ * empty components (from "//") are skipped.
+ */
+inline bool exists_link(hid_t loc_id, std::string const& path)
+{
+    if (path.empty()) {
+        return false;
+    }
+    std::string::size_type pos = path.find_first_not_of('/');
+    if (pos == std::string::npos || path == ".") {
+        return true;
+    }
+    htri_t exists = 1;
+    H5E_BEGIN_TRY {
+        while (exists > 0 && pos != std::string::npos) {
+            std::string::size_type end = path.find('/', pos);
+            // H5Lexists fails on "." as final component, empty components are skipped above
+            if (path.compare(pos, end - pos, ".") != 0) {
+                exists = H5Lexists(loc_id, path.substr(0, end).c_str(), H5P_DEFAULT);
+            }
+            pos = path.find_first_not_of('/', end);
+        }
+    } H5E_END_TRY
+    return exists > 0;
+}
+
+template <typename h5xxObject>
+inline bool exists_link(h5xxObject const& object, std::string const& path)
+{
+    return exists_link(object.hid(), path);
+}
+
+/**
+ * Return the type of the object at 'path' relative to the given object, or
+ * H5O_TYPE_UNKNOWN if the path does not resolve to an object, e.g., for a
+ * dangling soft link. Only the basic object header information is read.
+ */
+inline H5O_type_t get_object_type(hid_t loc_id, std::string const& path)
+{
+    H5O_type_t type = H5O_TYPE_UNKNOWN;
+    if (!exists_link(loc_id, path)) {
+        return type;
+    }
+    H5E_BEGIN_TRY {
+#if H5_VERSION_GE(1,12,0)
+        H5O_info2_t info;
+        herr_t retval = H5Oget_info_by_name3(loc_id, path.c_str(), &info, H5O_INFO_BASIC, H5P_DEFAULT);
+#elif H5_VERSION_GE(1,10,3)
+        H5O_info_t info;
+        herr_t retval = H5Oget_info_by_name2(loc_id, path.c_str(), &info, H5O_INFO_BASIC, H5P_DEFAULT);
+#else
+        H5O_info_t info;
+        herr_t retval = H5Oget_info_by_name(loc_id, path.c_str(), &info, H5P_DEFAULT);
+#endif
+        if (retval >= 0) {
+            type = info.type;
+        }
+    } H5E_END_TRY
+    return type;
+}
+
+template <typename h5xxObject>
+inline H5O_type_t get_object_type(h5xxObject const& object, std::string const& path)
+{
+    return get_object_type(object.hid(), path);
+}
+
+/**
+ * Return true if 'path' relative to the given object resolves to an object.
+ */
+template <typename h5xxObject>
+inline bool exists_object(h5xxObject const& object, std::string const& path)
+{
+    return get_object_type(object.hid(), path) != H5O_TYPE_UNKNOWN;
+}
+
+namespace detail {
+
+/**
+ * release the memory allocated by the HDF5 library for variable-length data
+ * read with the given memory type and dataspace
+ */
+inline herr_t vlen_reclaim(hid_t type_id, hid_t space_id, hid_t xfer_plist_id, void* buffer)
+{
+#if H5_VERSION_GE(1,12,0)
+    return H5Treclaim(type_id, space_id, xfer_plist_id, buffer);
+#else
+    return H5Dvlen_reclaim(type_id, space_id, xfer_plist_id, buffer);
+#endif
+}
+
+} // namespace detail
 
 } // namespace h5xx
 
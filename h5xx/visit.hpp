@@ -0,0 +1,268 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#ifndef H5XX_VISIT_HPP
+#define H5XX_VISIT_HPP
+
+#include <h5xx/hdf5_compat.hpp>
+#include <h5xx/error.hpp>
+#include <h5xx/utility.hpp>
+
+#include <algorithm>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace h5xx {
+
+/**
+ * Summary of an HDF5 object as reported by visit() and stat(). The
+ * dataset-specific members are left empty (or set to an invalid value) for
+ * groups and named datatypes.
+ */
+struct object_info
+{
+    /** absolute path of the object; hard-linked objects are reported once */
+    std::string path;
+    H5O_type_t type;
+
+    /** current extents of the dataspace, empty for scalar datasets */
+    std::vector<hsize_t> shape;
+
+    /** class and size in bytes of the (file) datatype */
+    H5T_class_t dtype_class;
+    size_t dtype_size;
+
+    /** storage layout and identifiers of the filters in the pipeline */
+    H5D_layout_t layout;
+    std::vector<H5Z_filter_t> filters;
+
+    object_info()
+      : type(H5O_TYPE_UNKNOWN), dtype_class(H5T_NO_CLASS), dtype_size(0), layout(H5D_LAYOUT_ERROR)
+    {}
+};
+
+namespace detail {
+
+struct visit_data
+{
+    std::string prefix;
+    std::vector<object_info>* entries;
+    std::string error_name;
+};
+
+/**
+ * Query dataset properties from its dataspace, datatype and creation
+ * property list. Returns false if any of the calls fails.
+ */
+inline bool get_dataset_info(hid_t dataset_id, object_info& info)
+{
+    bool err = false;
+
+    hid_t space_id = H5Dget_space(dataset_id);
+    int rank = space_id >= 0 ? H5Sget_simple_extent_ndims(space_id) : -1;
+    if (rank > 0) {
+        info.shape.resize(rank);
+        err |= H5Sget_simple_extent_dims(space_id, &*info.shape.begin(), NULL) < 0;
+    }
+    err |= rank < 0;
+    if (space_id >= 0) {
+        H5Sclose(space_id);
+    }
+
+    hid_t type_id = H5Dget_type(dataset_id);
+    if (type_id >= 0) {
+        info.dtype_class = H5Tget_class(type_id);
+        info.dtype_size = H5Tget_size(type_id);
+        H5Tclose(type_id);
+    }
+    err |= type_id < 0;
+
+    hid_t dcpl = H5Dget_create_plist(dataset_id);
+    if (dcpl >= 0) {
+        info.layout = H5Pget_layout(dcpl);
+        int nfilters = H5Pget_nfilters(dcpl);
+        for (int i = 0; i < nfilters; ++i) {
+            unsigned int flags;
+            size_t cd_nelmts = 0;
+            info.filters.push_back(H5Pget_filter2(dcpl, i, &flags, &cd_nelmts, NULL, 0, NULL, NULL));
+        }
+        H5Pclose(dcpl);
+    }
+    err |= dcpl < 0;
+
+    return !err;
+}
+
+/**
+ * H5Ovisit callback: record path and type of each object, only datasets
+ * are opened to obtain their properties
+ *
+ * @return code: success: 0, error: < 0
+ */
+template <typename info_type>
+herr_t visit_object(hid_t obj_id, char const* name, info_type const* obj_info, void* op_data)
+{
+    visit_data* data = reinterpret_cast<visit_data*>(op_data);
+
+    object_info info;
+    info.type = obj_info->type;
+    if (name[0] == '.' && name[1] == '\0') {
+        info.path = data->prefix.empty() ? "/" : data->prefix;
+    }
+    else {
+        info.path = data->prefix + "/" + name;
+    }
+
+    if (info.type == H5O_TYPE_DATASET) {
+        hid_t dataset_id = H5Dopen(obj_id, name, H5P_DEFAULT);
+        bool ok = dataset_id >= 0 && get_dataset_info(dataset_id, info);
+        if (dataset_id >= 0) {
+            H5Dclose(dataset_id);
+        }
+        if (!ok) {
+            // exceptions must not propagate through the HDF5 library
+            data->error_name = info.path;
+            return -1;
+        }
+    }
+
+    data->entries->push_back(info);
+    return 0;
+}
+
+} // namespace detail
+
+/**
+ * Walk recursively the hierarchy below (and including) the given file,
+ * group, or dataset in a single pass, and return a summary of each object
+ * in increasing order of names.
+ *
+ * Only the basic object header information is read for groups and named
+ * datatypes; datasets are opened to query their shape, datatype, storage
+ * layout, and filters.
+ */
+template <typename h5xxObject>
+inline std::vector<object_info> visit(h5xxObject const& object)
+{
+    std::vector<object_info> entries;
+    detail::visit_data data;
+    data.entries = &entries;
+    data.prefix = get_name(object);
+    if (data.prefix == "/") {
+        data.prefix = std::string();
+    }
+
+#if H5_VERSION_GE(1,12,0)
+    herr_t retval = H5Ovisit3(object.hid(), H5_INDEX_NAME, H5_ITER_INC, detail::visit_object<H5O_info2_t>, &data, H5O_INFO_BASIC);
+#elif H5_VERSION_GE(1,10,3)
+    herr_t retval = H5Ovisit2(object.hid(), H5_INDEX_NAME, H5_ITER_INC, detail::visit_object<H5O_info_t>, &data, H5O_INFO_BASIC);
+#else
+    herr_t retval = H5Ovisit(object.hid(), H5_INDEX_NAME, H5_ITER_INC, detail::visit_object<H5O_info_t>, &data);
+#endif
+    if (retval < 0) {
+        throw error("failed to visit object " + (data.error_name.empty() ? get_name(object) : data.error_name));
+    }
+    return entries;
+}
+
+/**
+ * Return a summary of the object at 'path' relative to the given object in a
+ * single call, as visit() does for each object. If there is no such object,
+ * the returned type is H5O_TYPE_UNKNOWN and no error is raised; see also
+ * get_object_type(). Only datasets are opened.
+ */
+template <typename h5xxObject>
+inline object_info stat(h5xxObject const& object, std::string const& path)
+{
+    object_info info;
+    info.type = get_object_type(object, path);
+    if (info.type == H5O_TYPE_UNKNOWN) {
+        return info;
+    }
+
+    if (!path.empty() && path[0] == '/') {
+        info.path = path;
+    }
+    else {
+        std::string prefix = get_name(object);
+        info.path = (prefix == "/" ? std::string() : prefix) + "/" + path;
+    }
+
+    if (info.type == H5O_TYPE_DATASET) {
+        hid_t dataset_id = H5Dopen(object.hid(), path.c_str(), H5P_DEFAULT);
+        bool ok = dataset_id >= 0 && detail::get_dataset_info(dataset_id, info);
+        if (dataset_id >= 0) {
+            H5Dclose(dataset_id);
+        }
+        if (!ok) {
+            throw error("querying properties of dataset \"" + info.path + "\"");
+        }
+    }
+    return info;
+}
+
+/**
+ * Walk the hierarchy below the given object as visit() does, and
+ * subsequently apply the function object 'f' to each of the collected
+ * object_info entries.
+ *
+ * The entries are processed by 'nthreads' concurrent threads, each
+ * working on a contiguous range of entries; the default uses as many
+ * threads as there are hardware threads. Since the HDF5 library is
+ * generally not thread-safe, 'f' must not call HDF5 functions if
+ * nthreads > 1. The first exception thrown by 'f' is rethrown after all
+ * threads have finished.
+ */
+template <typename h5xxObject, typename Function>
+inline void visit(h5xxObject const& object, Function f, unsigned int nthreads = 0)
+{
+    std::vector<object_info> const entries = visit(object);
+
+    if (nthreads == 0) {
+        nthreads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    nthreads = std::min<size_t>(nthreads, entries.size());
+
+    if (nthreads <= 1) {
+        std::for_each(entries.begin(), entries.end(), f);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(nthreads);
+    std::vector<std::thread> threads;
+    size_t chunk = (entries.size() + nthreads - 1) / nthreads;
+    for (unsigned int i = 0; i < nthreads; ++i) {
+        auto first = entries.begin() + std::min(i * chunk, entries.size());
+        auto last = entries.begin() + std::min((i + 1) * chunk, entries.size());
+        std::exception_ptr& err = errors[i];
+        threads.emplace_back([first, last, &f, &err]() {
+            try {
+                std::for_each(first, last, f);
+            }
+            catch (...) {
+                err = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto const& err : errors) {
+        if (err) {
+            std::rethrow_exception(err);
+        }
+    }
+}
+
+} // namespace h5xx
+
+#endif /* ! H5XX_VISIT_HPP */
@@ -82,6 +82,23 @@ BOOST_AUTO_TEST_CASE( scalar_fundamental )
     BOOST_CHECK_NO_THROW(write_attribute(file, "integral, scalar", uint_value));  // overwrite value
     BOOST_CHECK(read_attribute<uint64_t>(file, "integral, scalar") == uint_value);
 
+    // an attribute of equal type and shape is overwritten in place,
+    // an open handle sees the new value
+    BOOST_CHECK_NO_THROW(write_attribute(file, "time", 1.));
+    attribute time(file, "time");
+    BOOST_CHECK_NO_THROW(write_attribute(file, "time", 2.));
+    double time_value = 0;
+    time.read(ctype<double>::hid(), &time_value);
+    BOOST_CHECK_EQUAL(time_value, 2.);
+
+    // type mismatch: attribute is re-created
+    time = attribute();
+    BOOST_CHECK_NO_THROW(write_attribute(file, "time", 3));
+    BOOST_CHECK_EQUAL(read_attribute<int>(file, "time"), 3);
+    attribute time_int(file, "time");
+    hid_t type_id = time_int.get_type();
+    BOOST_CHECK(H5Tequal(type_id, ctype<int>::hid()) > 0);
+    H5Tclose(type_id);
 }
 
 BOOST_AUTO_TEST_CASE( scalar_stdstring )
@@ -113,6 +130,44 @@ BOOST_AUTO_TEST_CASE( scalar_stdstring )
     */
 }
 
+BOOST_AUTO_TEST_CASE( datatype_cache )
+{
+    // string datatypes are created once and handed out with an extra reference
+    hid_t type_id = detail::cached_string_type(16, H5T_STR_NULLPAD);
+    BOOST_CHECK_EQUAL(H5Tget_size(type_id), 16u);
+    BOOST_CHECK_EQUAL(H5Tget_strpad(type_id), H5T_STR_NULLPAD);
+    int count = H5Iget_ref(type_id);
+    hid_t same_id = policy::string::null_padded().cached_type(16);
+    BOOST_CHECK_EQUAL(same_id, type_id);
+    BOOST_CHECK_EQUAL(H5Iget_ref(type_id), count + 1);
+    BOOST_CHECK(detail::release_type(same_id) >= 0);
+
+    // the public make_type() returns a copy owned by the caller
+    hid_t copy_id = policy::string::null_padded().make_type(16);
+    BOOST_CHECK(copy_id != type_id);
+    BOOST_CHECK(H5Tequal(copy_id, type_id) > 0);
+    BOOST_CHECK_EQUAL(H5Iget_ref(type_id), count);
+    BOOST_CHECK(H5Tset_size(copy_id, 8) >= 0);
+    BOOST_CHECK(H5Tclose(copy_id) >= 0);
+
+    BOOST_CHECK(detail::release_type(type_id) >= 0);
+    BOOST_CHECK(H5Iis_valid(type_id) > 0);      // still owned by the cache
+
+    // shared types are locked
+    H5E_BEGIN_TRY {
+        BOOST_CHECK(H5Tset_size(type_id, 8) < 0);
+        BOOST_CHECK(H5Tclose(type_id) < 0);
+    } H5E_END_TRY
+    BOOST_CHECK_EQUAL(H5Tget_size(type_id), 16u);
+
+    hid_t other_id = detail::cached_string_type(16, H5T_STR_NULLTERM);
+    BOOST_CHECK(other_id != type_id);
+    detail::release_type(other_id);
+    other_id = policy::string::variable_length().make_type(0);
+    BOOST_CHECK(H5Tis_variable_str(other_id) > 0);
+    BOOST_CHECK(H5Tclose(other_id) >= 0);
+}
+
 BOOST_AUTO_TEST_CASE( scalar_cstring )
 {
     char const* cstring = "Highly accelerated large-scale molecular dynamics simulation package";;
@@ -246,6 +301,18 @@ BOOST_AUTO_TEST_CASE( stdvector_string )
     BOOST_CHECK_NO_THROW(write_attribute(file, "std::vector, string", output));
     BOOST_CHECK_NO_THROW(input = read_attribute<std::vector<std::string> >(file, "std::vector, string"));
     BOOST_CHECK_EQUAL_COLLECTIONS(input.begin(), input.end(), output.begin(), output.end());
+
+    // longer strings change the datatype
+    output[2] = "HAL's MD package: highly accelerated large-scale molecular dynamics simulation package";
+    BOOST_CHECK_NO_THROW(write_attribute(file, "std::vector, string", output));
+    BOOST_CHECK_NO_THROW(input = read_attribute<std::vector<std::string> >(file, "std::vector, string"));
+    BOOST_CHECK_EQUAL_COLLECTIONS(input.begin(), input.end(), output.begin(), output.end());
+
+    // different shape
+    output.pop_back();
+    BOOST_CHECK_NO_THROW(write_attribute(file, "std::vector, string", output));
+    BOOST_CHECK_NO_THROW(input = read_attribute<std::vector<std::string> >(file, "std::vector, string"));
+    BOOST_CHECK_EQUAL_COLLECTIONS(input.begin(), input.end(), output.begin(), output.end());
 }
 
 BOOST_AUTO_TEST_CASE( boost_multi_array)
@@ -259,4 +326,130 @@ BOOST_AUTO_TEST_CASE( boost_multi_array)
     BOOST_CHECK_NO_THROW(read = read_attribute<multi_array3>(file, "boost multi array, int"));
     BOOST_CHECK(read == multi_array_value);
 }
+
+BOOST_AUTO_TEST_CASE( bulk )
+{
+    group grp(file, "bulk");
+    attribute_map output;
+    output["count"] = 42LL;
+    output["mask"] = 0xffffffffffffffffULL;
+    output["time"] = 1.5;
+    output["unit"] = std::string("nm");
+    output["box"] = std::vector<double>(3, 10.);
+    output["labels"] = std::vector<std::string>(2, "A");
+    BOOST_CHECK_NO_THROW(write_attributes(grp, output));
+    BOOST_CHECK(exists_attribute(grp, "unit"));
+    BOOST_CHECK_EQUAL(read_attribute<double>(grp, "time"), 1.5);
+
+    // further attributes of types not written by write_attributes()
+    boost::multi_array<int, 2> matrix(boost::extents[2][2]);
+    int data[] = {1, 2, 3, 4};
+    matrix.assign(data, data + 4);
+    write_attribute(grp, "matrix", matrix);
+    write_attribute(grp, "vlen", std::string("variable"), policy::string::variable_length());
+    write_attribute(grp, "float", 0.5f);
+    write_attribute(grp, "nullpad", std::string("hello"), policy::string::null_padded());
+    write_attribute(grp, "spacepad", std::string("hello"), policy::string::space_padded());
+
+    attribute_map input;
+    BOOST_CHECK_NO_THROW(input = read_all_attributes(grp));
+    BOOST_CHECK_EQUAL(input.size(), 11u);
+    BOOST_CHECK_EQUAL(boost::get<long long>(input["count"]), 42);
+    BOOST_CHECK_EQUAL(boost::get<unsigned long long>(input["mask"]), 0xffffffffffffffffULL);
+    BOOST_CHECK_EQUAL(boost::get<double>(input["time"]), 1.5);
+    BOOST_CHECK_EQUAL(boost::get<std::string>(input["unit"]), "nm");
+    BOOST_CHECK(boost::get<std::vector<double> >(input["box"]) == std::vector<double>(3, 10.));
+    BOOST_CHECK(boost::get<std::vector<std::string> >(input["labels"]) == std::vector<std::string>(2, "A"));
+    std::vector<long long> const& flat = boost::get<std::vector<long long> >(input["matrix"]);
+    BOOST_CHECK_EQUAL_COLLECTIONS(flat.begin(), flat.end(), data, data + 4);
+    BOOST_CHECK_EQUAL(boost::get<std::string>(input["vlen"]), "variable");
+    BOOST_CHECK_EQUAL(boost::get<double>(input["float"]), 0.5);
+    BOOST_CHECK_EQUAL(boost::get<std::string>(input["nullpad"]), "hello");
+    BOOST_CHECK_EQUAL(boost::get<std::string>(input["spacepad"]), "hello");
+
+    // round trip to another object
+    group copy(file, "bulk copy");
+    BOOST_CHECK_NO_THROW(write_attributes(copy, input));
+    BOOST_CHECK(read_all_attributes(copy) == input);
+
+    // integer attributes keep their width if written back
+    write_attribute(grp, "short", short(-3));
+    write_attribute(grp, "narrow", std::vector<unsigned int>(2, 5));
+    BOOST_CHECK_NO_THROW(write_attributes(grp, read_all_attributes(grp)));
+    input = read_all_attributes(grp);
+    BOOST_CHECK_EQUAL(boost::get<long long>(input["short"]), -3);
+    BOOST_CHECK(boost::get<std::vector<unsigned long long> >(input["narrow"]) == std::vector<unsigned long long>(2, 5));
+    {
+        attribute attr(grp, "short");
+        hid_t type_id = attr.get_type();
+        BOOST_CHECK_EQUAL(H5Tget_size(type_id), sizeof(short));
+        H5Tclose(type_id);
+    }
+    {
+        attribute attr(grp, "narrow");
+        hid_t type_id = attr.get_type();
+        BOOST_CHECK_EQUAL(H5Tget_size(type_id), sizeof(unsigned int));
+        H5Tclose(type_id);
+    }
+
+    // values out of range replace the attribute
+    input["short"] = 100000LL;
+    BOOST_CHECK_NO_THROW(write_attributes(grp, input));
+    BOOST_CHECK_EQUAL(read_attribute<long long>(grp, "short"), 100000);
+}
+
+BOOST_AUTO_TEST_CASE( dense_storage )
+{
+    // group with dense attribute storage above 4 attributes, indexed creation order
+    group_options options;
+    options.attr_max_compact = 4;
+    options.attr_min_dense = 2;
+    options.attr_index_order = true;
+    group grp(file, "many attributes", options);
+
+    hid_t gcpl = H5Gget_create_plist(grp.hid());
+    unsigned int max_compact, min_dense, flags;
+    H5Pget_attr_phase_change(gcpl, &max_compact, &min_dense);
+    H5Pget_attr_creation_order(gcpl, &flags);
+    H5Pclose(gcpl);
+    BOOST_CHECK_EQUAL(max_compact, 4u);
+    BOOST_CHECK_EQUAL(min_dense, 2u);
+    BOOST_CHECK_EQUAL(flags, unsigned(H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED));
+
+    // iterate attributes in creation order
+    std::vector<std::string> names;
+    for (int i = 9; i >= 0; --i) {
+        names.push_back("attr" + boost::lexical_cast<std::string>(i));
+        write_attribute(grp, names.back(), i);
+    }
+    container<attribute> attributes = grp.attributes();
+    BOOST_CHECK_EQUAL(attributes.size(), 10u);
+    BOOST_CHECK_EQUAL(attributes.index_type(), H5_INDEX_CRT_ORDER);
+    std::vector<std::string> order;
+    for (auto it = attributes.begin(); it != attributes.end(); ++it) {
+        order.push_back(it.get_name());
+    }
+    BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), names.begin(), names.end());
+
+    // dataset with attribute storage modifier, iteration in order of names
+    std::vector<size_t> chunk(1, 4);
+    dataset dset = create_dataset(grp, "dset", ctype<int>::hid(), dataspace(std::vector<hsize_t>(1, 8))
+      , policy::storage::chunked(chunk).set(policy::storage::attribute_storage(0, 0, true)));
+    hid_t dcpl = H5Dget_create_plist(dset.hid());
+    H5Pget_attr_creation_order(dcpl, &flags);
+    H5Pclose(dcpl);
+    BOOST_CHECK_EQUAL(flags, unsigned(H5P_CRT_ORDER_TRACKED));
+
+    write_attribute(dset, "b", 1);
+    write_attribute(dset, "a", 2);
+    container<attribute> dset_attributes(dset);
+    BOOST_CHECK_EQUAL(dset_attributes.index_type(), H5_INDEX_NAME);
+    auto it = dset_attributes.begin();
+    BOOST_CHECK_EQUAL(it.get_name(), "a");
+    BOOST_CHECK_EQUAL(read_attribute<int>(dset, (it++).get_name()), 2);
+    BOOST_CHECK_EQUAL(get_name(*it), "/many attributes/dset/b");
+    BOOST_CHECK(++it == dset_attributes.end());
+    BOOST_CHECK_THROW(*it, std::out_of_range);
+}
+
 } //namespace fixture
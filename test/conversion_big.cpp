@@ -0,0 +1,143 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#define BOOST_TEST_MODULE h5xx_conversion
+#include <boost/test/unit_test.hpp>
+
+#include <h5xx/h5xx.hpp>
+#include <test/ctest_full_output.hpp>
+#include <test/fixture.hpp>
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace h5xx;
+
+BOOST_GLOBAL_FIXTURE( ctest_full_output );
+
+namespace fixture { // preferred over BOOST_FIXTURE_TEST_SUITE
+
+char filename[] = "test_h5xx_conversion_big.h5";
+typedef h5file<filename> BOOST_AUTO_TEST_CASE_FIXTURE;
+
+const size_t size = 1 << 24;
+const int repeat = 5;
+
+/**
+ * Read the dataset into a vector of T with the HDF5 conversion and the h5xx
+ * kernels, report the best of several timings and compare the results.
+ */
+template <typename T>
+void benchmark(h5xx::file const& file, std::string const& name)
+{
+    std::vector<T> value_hdf5, value_kernel;
+    double t_hdf5 = 1e30, t_kernel = 1e30;
+    for (int i = 0; i < repeat; ++i) {
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        read_dataset(file, name, value_hdf5, policy::conversion::hdf5());
+        std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+        read_dataset(file, name, value_kernel, policy::conversion::kernel());
+        std::chrono::steady_clock::time_point t2 = std::chrono::steady_clock::now();
+        t_hdf5 = std::min(t_hdf5, std::chrono::duration<double>(t1 - t0).count());
+        t_kernel = std::min(t_kernel, std::chrono::duration<double>(t2 - t1).count());
+    }
+    BOOST_CHECK(value_kernel == value_hdf5);
+    BOOST_TEST_MESSAGE(name << " -> " << sizeof(T) << " bytes: HDF5 " << t_hdf5 * 1e3 << " ms, h5xx kernel "
+        << t_kernel * 1e3 << " ms, speed-up " << t_hdf5 / t_kernel);
+}
+
+/** create dataset of given file type from native data */
+template <typename T>
+void create(h5xx::file const& file, std::string const& name, hid_t file_type_id, std::vector<T> const& value)
+{
+    hsize_t dims = value.size();
+    hid_t space_id = H5Screate_simple(1, &dims, NULL);
+    hid_t dset_id = H5Dcreate(file.hid(), name.c_str(), file_type_id, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite(dset_id, ctype<T>::hid(), H5S_ALL, H5S_ALL, H5P_DEFAULT, &value[0]);
+    H5Dclose(dset_id);
+    H5Sclose(space_id);
+}
+
+BOOST_AUTO_TEST_CASE( floating_point )
+{
+    std::vector<double> value(size);
+    for (size_t i = 0; i < size; ++i) {
+        value[i] = std::sin(1e-3 * i);
+    }
+    create(file, "double, LE", H5T_IEEE_F64LE, value);
+    create(file, "double, BE", H5T_IEEE_F64BE, value);
+    create(file, "float, BE", H5T_IEEE_F32BE, value);
+
+    benchmark<float>(file, "double, LE");
+    benchmark<float>(file, "double, BE");
+    benchmark<double>(file, "double, BE");
+    benchmark<double>(file, "float, BE");
+}
+
+BOOST_AUTO_TEST_CASE( integer )
+{
+    std::vector<int> value(size);
+    for (size_t i = 0; i < size; ++i) {
+        value[i] = int(i) - int(size / 2);
+    }
+    create(file, "int32, LE", H5T_STD_I32LE, value);
+    create(file, "int32, BE", H5T_STD_I32BE, value);
+
+    benchmark<int>(file, "int32, BE");
+    benchmark<long long>(file, "int32, LE");
+    benchmark<long long>(file, "int32, BE");
+    benchmark<short>(file, "int32, LE");
+}
+
+/**
+ * Read the dataset into a newly allocated container, which includes the
+ * page faults upon first touch of the memory; report the best of several
+ * timings.
+ */
+template <typename Container>
+double time_fresh_read(h5xx::file const& file, std::string const& name)
+{
+    double t = 1e30;
+    for (int i = 0; i < repeat; ++i) {
+        std::chrono::steady_clock::time_point t0 = std::chrono::steady_clock::now();
+        {
+            Container value;
+            read_dataset(file, name, value);
+        }
+        std::chrono::steady_clock::time_point t1 = std::chrono::steady_clock::now();
+        t = std::min(t, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return t;
+}
+
+BOOST_AUTO_TEST_CASE( allocator )
+{
+    std::vector<double> value(4 * size);
+    for (size_t i = 0; i < value.size(); ++i) {
+        value[i] = 1e-3 * i;
+    }
+    create_dataset(file, "double", value);
+    write_dataset(file, "double", value);
+
+    double t_std = time_fresh_read<std::vector<double> >(file, "double");
+    double t_aligned = time_fresh_read<std::vector<double, h5xx::aligned_allocator<double> > >(file, "double");
+    double t_huge = time_fresh_read<std::vector<double, hugepage_allocator<double> > >(file, "double");
+    BOOST_TEST_MESSAGE("reading " << (value.size() * sizeof(double) >> 20) << " MiB into new std::vector: "
+        << "std::allocator " << t_std * 1e3 << " ms, aligned_allocator " << t_aligned * 1e3
+        << " ms, hugepage_allocator " << t_huge * 1e3 << " ms");
+
+    std::vector<double, hugepage_allocator<double> > value_read;
+    read_dataset(file, "double", value_read);
+    BOOST_CHECK(std::equal(value_read.begin(), value_read.end(), value.begin()));
+}
+
+} //namespace fixture
@@ -18,10 +18,35 @@
 #include <test/catch_boost_no_throw.hpp>
 #include <test/fixture.hpp>
 
+#include <sys/wait.h>
 #include <unistd.h>
+#include <algorithm>
 #include <cmath>
 #include <string>
 
+struct particle
+{
+    double pos[3];
+    double vel[3];
+    int id;
+    char species;
+
+    bool operator==(particle const& other) const
+    {
+        return std::equal(pos, pos + 3, other.pos) && std::equal(vel, vel + 3, other.vel)
+            && id == other.id && species == other.species;
+    }
+};
+
+struct cell
+{
+    particle p;
+    float weight[2][2];
+};
+
+H5XX_COMPOUND(particle, pos, vel, id, species)
+H5XX_COMPOUND(cell, p, weight)
+
 using namespace h5xx;
 
 BOOST_GLOBAL_FIXTURE( ctest_full_output );
@@ -111,6 +136,423 @@ BOOST_AUTO_TEST_CASE( boost_multi_array_simple )
     BOOST_CHECK(arrayRead == multi_array_value);
 }
 
+// test datasets of compound type declared by H5XX_COMPOUND
+BOOST_AUTO_TEST_CASE( compound )
+{
+    BOOST_CHECK(detail::has_ctype<particle>::value);
+    BOOST_CHECK(!detail::has_ctype<std::string>::value);
+
+    hid_t type_id = ctype<particle>::hid();
+    BOOST_CHECK_EQUAL(ctype<particle>::hid(), type_id);     // type is cached
+    BOOST_CHECK_EQUAL(H5Tget_class(type_id), H5T_COMPOUND);
+    BOOST_CHECK_EQUAL(H5Tget_nmembers(type_id), 4);
+    BOOST_CHECK_EQUAL(H5Tget_size(type_id), sizeof(particle));
+    BOOST_CHECK_EQUAL(H5Tget_member_index(type_id, "species"), 3);
+    hid_t member_id = H5Tget_member_type(type_id, 0);
+    BOOST_CHECK_EQUAL(H5Tget_class(member_id), H5T_ARRAY);
+    H5Tclose(member_id);
+
+    std::vector<particle> particles(10);
+    for (unsigned int i = 0; i < particles.size(); ++i) {
+        particle& p = particles[i];
+        for (int j = 0; j < 3; ++j) {
+            p.pos[j] = i + 0.1 * j;
+            p.vel[j] = -p.pos[j];
+        }
+        p.id = i;
+        p.species = 'A' + i % 2;
+    }
+    std::vector<particle> read;
+    BOOST_CHECK_NO_THROW(create_dataset(file, "particles", particles));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "particles", particles));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "particles", read));
+    BOOST_CHECK(read == particles);
+
+    // read single fields only
+    std::vector<int> ids;
+    BOOST_CHECK_NO_THROW(read_field(file, "particles", "id", ids));
+    BOOST_REQUIRE_EQUAL(ids.size(), particles.size());
+    for (unsigned int i = 0; i < ids.size(); ++i) {
+        BOOST_CHECK_EQUAL(ids[i], particles[i].id);
+    }
+    dataset dset(file, "particles");
+    std::vector<double> species;                                       // with type conversion
+    BOOST_CHECK_NO_THROW(read_field(dset, "species", species, slice(std::vector<int>(1, 2), std::vector<int>(1, 3))));
+    BOOST_REQUIRE_EQUAL(species.size(), 3u);
+    BOOST_CHECK_EQUAL(species[0], 'A');
+    BOOST_CHECK_EQUAL(species[1], 'B');
+    BOOST_CHECK_THROW(read_field(dset, "mass", species), h5xx::error);
+
+    // multi-dimensional array of nested compound type
+    boost::multi_array<cell, 2> cells(boost::extents[2][3]), cells_read(boost::extents[2][3]);
+    for (unsigned int i = 0; i < cells.num_elements(); ++i) {
+        cell& c = cells.data()[i];
+        c.p = particles[i];
+        for (int j = 0; j < 4; ++j) {
+            c.weight[j / 2][j % 2] = i * j;
+        }
+    }
+    BOOST_CHECK_NO_THROW(create_dataset(file, "cells", cells));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "cells", cells));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "cells", cells_read));
+    for (unsigned int i = 0; i < cells.num_elements(); ++i) {
+        BOOST_CHECK(cells_read.data()[i].p == cells.data()[i].p);
+        BOOST_CHECK_EQUAL(cells_read.data()[i].weight[1][1], cells.data()[i].weight[1][1]);
+    }
+}
+
+// test complex numbers and fixed-size arrays as element type
+BOOST_AUTO_TEST_CASE( complex_and_array_elements )
+{
+    hid_t type_id = ctype<std::complex<double> >::hid();
+    BOOST_CHECK_EQUAL(H5Tget_class(type_id), H5T_COMPOUND);
+    BOOST_CHECK_EQUAL(H5Tget_member_index(type_id, "r"), 0);
+    BOOST_CHECK_EQUAL(H5Tget_member_index(type_id, "i"), 1);
+
+    std::vector<std::complex<double> > z, z_read;
+    for (int i = 0; i < 5; ++i) {
+        z.push_back(std::polar(1., i * 0.1));
+    }
+    BOOST_CHECK_NO_THROW(create_dataset(file, "complex", z));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "complex", z));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "complex", z_read));
+    BOOST_CHECK(z_read == z);
+
+    // read real parts only, via compound projection
+    std::vector<double> re;
+    BOOST_CHECK_NO_THROW(read_field(file, "complex", "r", re));
+    BOOST_REQUIRE_EQUAL(re.size(), z.size());
+    BOOST_CHECK_EQUAL(re[3], z[3].real());
+
+    typedef boost::array<double, 3> vector_type;
+    BOOST_CHECK_EQUAL(H5Tget_class(ctype<vector_type>::hid()), H5T_ARRAY);
+    BOOST_CHECK_EQUAL(H5Tget_size(ctype<vector_type>::hid()), sizeof(vector_type));
+    std::vector<vector_type> r(4), r_read;
+    for (unsigned int i = 0; i < r.size(); ++i) {
+        vector_type x = {{ i + 0., i + 1., i + 2. }};
+        r[i] = x;
+    }
+    BOOST_CHECK_NO_THROW(create_dataset(file, "array elements", r));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "array elements", r));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "array elements", r_read));
+    BOOST_CHECK(r_read == r);
+    BOOST_CHECK_EQUAL(dataspace(dataset(file, "array elements")).rank(), 1);
+}
+
+// test string datasets with fixed and variable length
+BOOST_AUTO_TEST_CASE( strings )
+{
+    std::string label = "HAL's MD package";
+    BOOST_CHECK_NO_THROW(create_dataset(file, "string", label));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "string", label));
+    BOOST_CHECK_EQUAL(read_dataset<std::string>(file, "string"), label);
+    BOOST_CHECK_NO_THROW(write_dataset(file, "string", std::string("HALMD")));   // shorter string
+    BOOST_CHECK_EQUAL(read_dataset<std::string>(file, "string"), "HALMD");
+
+    BOOST_CHECK_NO_THROW(create_dataset(file, "string, vlen", label, policy::string::variable_length()));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "string, vlen", label + label));
+    BOOST_CHECK_EQUAL(read_dataset<std::string>(file, "string, vlen"), label + label);
+
+    std::vector<std::string> labels, labels_read;
+    for (int i = 0; i < 100; ++i) {
+        labels.push_back(std::string(i % 7, 'a' + i % 26));
+    }
+    BOOST_CHECK_NO_THROW(create_dataset(file, "strings", labels));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "strings", labels));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "strings", labels_read));
+    BOOST_CHECK(labels_read == labels);
+
+    BOOST_CHECK_NO_THROW(create_dataset(file, "strings, space padded", labels, policy::string::space_padded()));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "strings, space padded", labels));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "strings, space padded", labels_read));
+    BOOST_CHECK(labels_read == labels);
+
+    labels[3] = std::string(1000, 'x');
+    BOOST_CHECK_NO_THROW(create_dataset(file, "strings, vlen", labels, policy::string::variable_length()
+      , policy::storage::chunked(std::vector<hsize_t>(1, 16))));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "strings, vlen", labels));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "strings, vlen", labels_read));
+    BOOST_CHECK(labels_read == labels);
+
+    BOOST_CHECK_THROW(write_dataset(file, "strings", std::vector<std::string>(3)), h5xx::error);
+    BOOST_CHECK_THROW(read_dataset<std::string>(file, "strings"), h5xx::error);
+}
+
+BOOST_AUTO_TEST_CASE( vlen_arena )
+{
+    std::vector<std::string> labels;
+    for (int i = 0; i < 1000; ++i) {
+        labels.push_back(std::string(i % 37, 'a' + i % 26));
+    }
+    labels[3] = std::string(5000, 'x');     // exceeds block size of arena
+    create_dataset(file, "strings", labels, policy::string::variable_length());
+    write_dataset(file, "strings", labels);
+
+    h5xx::vlen_arena arena(4096);
+    std::vector<boost::string_ref> views;
+    BOOST_CHECK_NO_THROW(read_dataset(file, "strings", views, arena));
+    BOOST_REQUIRE_EQUAL(views.size(), labels.size());
+    for (size_t i = 0; i < labels.size(); ++i) {
+        BOOST_CHECK_EQUAL(views[i].to_string(), labels[i]);
+    }
+
+    // blocks are reused after clear()
+    size_t capacity = arena.capacity();
+    arena.clear();
+    BOOST_CHECK_NO_THROW(read_dataset(file, "strings", views, arena));
+    BOOST_CHECK_EQUAL(arena.capacity(), capacity);
+    BOOST_CHECK_EQUAL(views[999].to_string(), labels[999]);
+
+    // ragged array of integers, written with the plain HDF5 API
+    std::vector<std::vector<int> > rows(50);
+    std::vector<hvl_t> buffer(rows.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        for (size_t j = 0; j < i % 9; ++j) {
+            rows[i].push_back(int(100 * i + j));
+        }
+        buffer[i].len = rows[i].size();
+        buffer[i].p = rows[i].empty() ? NULL : &rows[i][0];
+    }
+    hsize_t dims = rows.size();
+    hid_t type_id = H5Tvlen_create(H5T_NATIVE_INT);
+    hid_t space_id = H5Screate_simple(1, &dims, NULL);
+    hid_t dset_id = H5Dcreate(file.hid(), "ragged", type_id, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite(dset_id, type_id, H5S_ALL, H5S_ALL, H5P_DEFAULT, &buffer[0]);
+    H5Dclose(dset_id);
+    H5Sclose(space_id);
+    H5Tclose(type_id);
+
+    std::vector<boost::iterator_range<int const*> > ranges;
+    BOOST_CHECK_NO_THROW(read_dataset(file, "ragged", ranges, arena));
+    BOOST_REQUIRE_EQUAL(ranges.size(), rows.size());
+    for (size_t i = 0; i < rows.size(); ++i) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(ranges[i].begin(), ranges[i].end(), rows[i].begin(), rows[i].end());
+    }
+
+    BOOST_CHECK_THROW(read_dataset(file, "ragged", views, arena), h5xx::error);
+    BOOST_CHECK_THROW(read_dataset(file, "strings", ranges, arena), h5xx::error);
+}
+
+BOOST_AUTO_TEST_CASE( ragged )
+{
+    std::vector<std::vector<int> > rows(200), rows_read;
+    for (size_t i = 0; i < rows.size(); ++i) {
+        for (size_t j = 0; j < (i * 7) % 23; ++j) {
+            rows[i].push_back(int(1000 * i + j));
+        }
+    }
+
+    // variable-length sequences
+    BOOST_CHECK_NO_THROW(create_dataset(file, "vlen", rows));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "vlen", rows));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "vlen", rows_read));
+    BOOST_CHECK(rows_read == rows);
+    BOOST_CHECK_THROW(write_dataset(file, "vlen", std::vector<std::vector<int> >(3)), h5xx::error);
+    BOOST_CHECK_NO_THROW(create_dataset(file, "vlen_explicit", rows, policy::ragged::vlen()));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "vlen_explicit", rows, policy::ragged::vlen()));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "vlen_explicit", rows_read, policy::ragged::vlen()));
+    BOOST_CHECK(rows_read == rows);
+
+    // offsets and flat values
+    policy::ragged::offsets layout;
+    BOOST_CHECK_NO_THROW(create_dataset(file, "ragged", rows, layout
+      , policy::storage::chunked(std::vector<hsize_t>(1, 256)).add(policy::filter::deflate())));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "ragged", rows, layout));
+    BOOST_CHECK(exists_dataset(file, "ragged/offsets"));
+    BOOST_CHECK(exists_dataset(file, "ragged/values"));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "ragged", rows_read, layout));
+    BOOST_CHECK(rows_read == rows);
+
+    BOOST_CHECK_NO_THROW(read_dataset(file, "ragged", rows_read, layout, 17, 5));
+    BOOST_REQUIRE_EQUAL(rows_read.size(), 5u);
+    for (size_t i = 0; i < 5; ++i) {
+        BOOST_CHECK(rows_read[i] == rows[17 + i]);
+    }
+    BOOST_CHECK_THROW(read_dataset(file, "ragged", rows_read, layout, 199, 2), h5xx::error);
+
+    rows[0].push_back(1);
+    BOOST_CHECK_THROW(write_dataset(file, "ragged", rows, layout), h5xx::error);
+
+    // the offsets hold at least one entry
+    group broken(file, "broken");
+    create_dataset(broken, "offsets", std::vector<unsigned long long>());
+    create_dataset(broken, "values", std::vector<int>());
+    BOOST_CHECK_THROW(read_dataset(file, "broken", rows_read, layout), h5xx::error);
+    BOOST_CHECK_THROW(read_dataset(file, "broken", rows_read, layout, 0, 0), h5xx::error);
+}
+
+BOOST_AUTO_TEST_CASE( batch )
+{
+    std::vector<double> positions(300), positions_read;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        positions[i] = 0.5 * i;
+    }
+    boost::array<int, 4> ids = {{ 3, 1, 4, 1 }}, ids_read;
+    boost::multi_array<float, 2> forces(boost::extents[10][3]), forces_read;
+    for (size_t i = 0; i < forces.num_elements(); ++i) {
+        forces.data()[i] = -1.f * i;
+    }
+
+    dataset dset_pos = create_dataset(file, "positions", positions);
+    dataset dset_ids = create_dataset(file, "ids", ids);
+    dataset dset_forces = create_dataset(file, "forces", forces);
+
+    dataset_batch batch;
+    batch.write(dset_pos, positions);
+    batch.write(dset_ids, ids);
+    batch.write(dset_forces, forces);
+    BOOST_CHECK_EQUAL(batch.size(), 3u);
+    BOOST_CHECK_NO_THROW(batch.execute());
+    BOOST_CHECK(batch.empty());
+
+    std::vector<double> head(10);
+    batch.read(dset_pos, positions_read);
+    batch.read(dset_ids, ids_read);
+    batch.read(dset_forces, forces_read);
+    batch.read(dset_pos, head, slice("100:110"));
+    BOOST_CHECK_NO_THROW(batch.execute());
+    BOOST_CHECK(positions_read == positions);
+    BOOST_CHECK(ids_read == ids);
+    BOOST_CHECK(forces_read == forces);
+    BOOST_CHECK_EQUAL_COLLECTIONS(head.begin(), head.end(), positions.begin() + 100, positions.begin() + 110);
+
+    // the batch keeps the datasets open
+    std::vector<double> zeros(10, 0.);
+    {
+        dataset dset(file, "positions");
+        batch.write(dset, zeros, slice("0:10"));
+    }
+    BOOST_CHECK_NO_THROW(batch.execute());
+    read_dataset(file, "positions", positions_read);
+    BOOST_CHECK_EQUAL(positions_read[9], 0.);
+    BOOST_CHECK_EQUAL(positions_read[10], positions[10]);
+
+    boost::array<int, 3> wrong_size;
+    BOOST_CHECK_THROW(batch.read(dset_ids, wrong_size), h5xx::error);
+}
+
+BOOST_AUTO_TEST_CASE( conversion )
+{
+    std::vector<double> values(1000);
+    std::vector<int> ints(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::sin(0.1 * i) * 1e3;
+        ints[i] = int(i * i) - 5000;
+    }
+    create_dataset(file, "double", values);
+    write_dataset(file, "double", values);
+
+    // big-endian datasets, written with the plain HDF5 API
+    hsize_t dims = values.size();
+    hid_t space_id = H5Screate_simple(1, &dims, NULL);
+    hid_t dset_id = H5Dcreate(file.hid(), "double, BE", H5T_IEEE_F64BE, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite(dset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &values[0]);
+    H5Dclose(dset_id);
+    dset_id = H5Dcreate(file.hid(), "int, BE", H5T_STD_I32BE, space_id, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Dwrite(dset_id, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &ints[0]);
+    H5Dclose(dset_id);
+    H5Sclose(space_id);
+
+    BOOST_CHECK(!requires_conversion<double>(dataset(file, "double")));
+    BOOST_CHECK(requires_conversion<float>(dataset(file, "double")));
+    BOOST_CHECK(requires_conversion<double>(dataset(file, "double, BE")));
+
+    std::vector<double> doubles_read;
+    std::vector<float> floats_read;
+    std::vector<int> ints_read;
+    BOOST_CHECK_NO_THROW(read_dataset(file, "double", doubles_read, policy::conversion::strict()));
+    BOOST_CHECK(doubles_read == values);
+    BOOST_CHECK_THROW(read_dataset(file, "double", floats_read, policy::conversion::strict()), h5xx::error);
+    BOOST_CHECK_THROW(read_dataset(file, "double, BE", doubles_read, policy::conversion::strict()), h5xx::error);
+
+    // the h5xx kernels must give the same results as the HDF5 conversion
+    policy::conversion::kernel kernel;
+    std::vector<float> floats_hdf5;
+    read_dataset(file, "double", floats_hdf5);
+    BOOST_CHECK_NO_THROW(read_dataset(file, "double", floats_read, kernel));
+    BOOST_CHECK(floats_read == floats_hdf5);
+    BOOST_CHECK_NO_THROW(read_dataset(file, "double, BE", floats_read, kernel));
+    BOOST_CHECK(floats_read == floats_hdf5);
+    BOOST_CHECK_NO_THROW(read_dataset(file, "double, BE", doubles_read, kernel));
+    BOOST_CHECK(doubles_read == values);
+    BOOST_CHECK_NO_THROW(read_dataset(file, "int, BE", ints_read, kernel));
+    BOOST_CHECK(ints_read == ints);
+
+    // no kernel for integer to floating-point, falls back to HDF5
+    BOOST_CHECK_NO_THROW(read_dataset(file, "int, BE", doubles_read, kernel));
+    BOOST_CHECK_EQUAL(doubles_read[999], double(ints[999]));
+
+    boost::multi_array<float, 1> array;
+    dataset dset(file, "double, BE");
+    BOOST_CHECK_NO_THROW(read_dataset(dset, array, kernel));
+    BOOST_CHECK(std::equal(array.begin(), array.end(), floats_hdf5.begin()));
+
+    // integer widening and saturating narrowing over several blocks
+    std::vector<long long> longs_read;
+    std::vector<short> shorts_read, shorts_hdf5;
+    std::vector<unsigned char> bytes_read, bytes_hdf5;
+    ints.resize(100000);
+    for (size_t i = 0; i < ints.size(); ++i) {
+        ints[i] = int(i * i) - 5000;
+    }
+    create_dataset(file, "int", ints);
+    write_dataset(file, "int", ints);
+    BOOST_CHECK_NO_THROW(read_dataset(file, "int", longs_read, kernel));
+    BOOST_CHECK(std::equal(longs_read.begin(), longs_read.end(), ints.begin()));
+    read_dataset(file, "int", shorts_hdf5);
+    BOOST_CHECK_NO_THROW(read_dataset(file, "int", shorts_read, kernel));
+    BOOST_CHECK(shorts_read == shorts_hdf5);
+    read_dataset(file, "int", bytes_hdf5);
+    BOOST_CHECK_NO_THROW(read_dataset(file, "int", bytes_read, kernel));
+    BOOST_CHECK(bytes_read == bytes_hdf5);
+
+    // narrowing of a 2D dataset in several slabs
+    boost::multi_array<double, 2> matrix(boost::extents[700][800]);
+    for (size_t i = 0; i < matrix.num_elements(); ++i) {
+        matrix.data()[i] = 1. / (i + 1);
+    }
+    create_dataset(file, "matrix", matrix);
+    write_dataset(file, "matrix", matrix);
+    boost::multi_array<float, 2> matrix_read;
+    dset = dataset(file, "matrix");
+    BOOST_CHECK_NO_THROW(read_dataset(dset, matrix_read, kernel));
+    BOOST_CHECK_EQUAL(matrix_read.shape()[1], 800u);
+    bool equal = true;
+    for (size_t i = 0; i < matrix.num_elements(); ++i) {
+        equal &= matrix_read.data()[i] == float(matrix.data()[i]);
+    }
+    BOOST_CHECK(equal);
+}
+
+BOOST_AUTO_TEST_CASE( aligned_allocator )
+{
+    std::vector<double, hugepage_allocator<double> > values(1 << 19), values_read;
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = 0.5 * i;
+    }
+    BOOST_CHECK_NO_THROW(create_dataset(file, "vector", values));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "vector", values));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "vector", values_read));
+    BOOST_CHECK(values_read == values);
+    BOOST_CHECK_EQUAL(reinterpret_cast<size_t>(&values_read[0]) % huge_page_size, 0u);
+
+    std::vector<float, page_aligned_allocator<float> > floats_read;
+    BOOST_CHECK_NO_THROW(read_dataset(file, "vector", floats_read, policy::conversion::kernel()));
+    BOOST_CHECK_EQUAL(floats_read[1000], 500.f);
+    BOOST_CHECK_EQUAL(reinterpret_cast<size_t>(&floats_read[0]) % 4096, 0u);
+
+    typedef boost::multi_array<int, 2, h5xx::aligned_allocator<int, 64> > array_type;
+    array_type array(boost::extents[30][7]), array_read;
+    for (size_t i = 0; i < array.num_elements(); ++i) {
+        array.data()[i] = int(i);
+    }
+    BOOST_CHECK_NO_THROW(create_dataset(file, "multi_array", array));
+    BOOST_CHECK_NO_THROW(write_dataset(file, "multi_array", array));
+    BOOST_CHECK_NO_THROW(read_dataset(file, "multi_array", array_read));
+    BOOST_CHECK(array_read == array);
+    BOOST_CHECK_EQUAL(reinterpret_cast<size_t>(array_read.data()) % 64, 0u);
+}
+
 // test chunked dataset and the filters (compression, etc) it can use
 BOOST_AUTO_TEST_CASE( boost_multi_array_chunked )
 {
@@ -364,4 +806,156 @@ BOOST_AUTO_TEST_CASE( h5xx_dataset_hyperslab )
 
 // TODO : add more slicing tests here
 
+// append to a dataset in SWMR mode while a second process reads it
+BOOST_AUTO_TEST_CASE( swmr )
+{
+    char const* swmr_filename = "test_h5xx_dataset_swmr.h5";
+    const int nframes = 20;
+    unlink(swmr_filename);
+
+    // fork before opening the file, the reader must not share the writer's HDF5 file state
+    pid_t pid = fork();
+    if (pid == 0) {
+        // reader process: wait for the writer to switch to SWMR mode, then
+        // poll until all frames have arrived and check values
+        int status = 1;
+        try {
+            h5xx::file reader;
+            dataset frames;
+            for (int i = 0; i < 10000 && !frames.valid(); ++i) {
+                usleep(1000);
+                H5E_BEGIN_TRY {
+                    try {
+                        reader.open(swmr_filename, h5xx::file::in | h5xx::file::swmr_read);
+                        frames = dataset(reader, "frames");
+                    }
+                    catch (h5xx::error const&) {
+                        reader.close();
+                    }
+                } H5E_END_TRY
+            }
+            std::vector<int> values;
+            for (int i = 0; i < 10000 && values.size() < unsigned(nframes); ++i) {
+                usleep(1000);
+                frames.refresh();
+                read_dataset(frames, values);
+            }
+            status = values.size() == unsigned(nframes) ? 0 : 2;
+            for (int i = 0; i < int(values.size()); ++i) {
+                status |= (values[i] == i * i) ? 0 : 4;
+            }
+        }
+        catch (...) {}
+        _exit(status);
+    }
+    BOOST_REQUIRE(pid > 0);
+
+    // writer process: create extensible dataset, then switch to SWMR mode
+    file_options opts;
+    opts.libver_low = H5F_LIBVER_LATEST;
+    h5xx::file writer(swmr_filename, opts, h5xx::file::trunc);
+    std::vector<hsize_t> dims(1, 0), max_dims(1, H5S_UNLIMITED), chunk(1, 4);
+    dataset dset = create_dataset(writer, "frames", ctype<int>::hid(), dataspace(dims, max_dims), policy::storage::chunked(chunk));
+    BOOST_CHECK_THROW(dset.set_extent(std::vector<hsize_t>()), h5xx::error);
+    BOOST_CHECK_THROW(dset.set_extent(std::vector<hsize_t>(2, 1)), h5xx::error);
+    BOOST_CHECK_NO_THROW(writer.start_swmr_write());
+
+    // append frame by frame
+    for (int i = 0; i < nframes; ++i) {
+        std::vector<int> frame(1, i * i);
+        std::vector<int> offset(1, i), count(1, 1);
+        dims[0] = i + 1;
+        BOOST_CHECK_NO_THROW(dset.set_extent(dims));
+        BOOST_CHECK_NO_THROW(write_dataset(dset, frame, slice(offset, count)));
+        BOOST_CHECK_NO_THROW(dset.flush());
+        usleep(1000);
+    }
+
+    int status;
+    BOOST_CHECK_EQUAL(waitpid(pid, &status, 0), pid);
+    BOOST_CHECK(WIFEXITED(status));
+    BOOST_CHECK_EQUAL(WEXITSTATUS(status), 0);
+
+    dset = dataset();
+    writer.close(true);
+
+    // open in SWMR write mode directly
+    BOOST_CHECK_NO_THROW(h5xx::file(swmr_filename, h5xx::file::swmr_write));
+    BOOST_CHECK_THROW(h5xx::file(swmr_filename, h5xx::file::out | h5xx::file::swmr_read), h5xx::error);
+    unlink(swmr_filename);
+}
+
+BOOST_AUTO_TEST_CASE( try_read )
+{
+    std::vector<int> values(10, 7), values_read;
+    create_dataset(file, "present", values);
+    write_dataset(file, "present", values);
+    group grp(file, "subgroup");
+    write_attribute(grp, "step", 42);
+
+    // missing objects, also below missing intermediate groups
+    status s = try_read_dataset(file, "missing", values_read);
+    BOOST_CHECK(!s);
+    BOOST_CHECK_EQUAL(s.code(), status::not_found);
+    BOOST_CHECK(s.message().find("\"missing\"") != std::string::npos);
+    BOOST_CHECK_EQUAL(try_read_dataset(file, "no/such/path", values_read).code(), status::not_found);
+    BOOST_CHECK_EQUAL(try_read_dataset(file, "subgroup", values_read).code(), status::type_mismatch);
+    BOOST_CHECK(values_read.empty());
+    BOOST_CHECK_THROW(s.raise(), error);
+
+    // present objects
+    s = try_read_dataset(file, "present", values_read);
+    BOOST_CHECK(s);
+    BOOST_CHECK(s.message().empty());
+    BOOST_CHECK_NO_THROW(s.raise());
+    BOOST_CHECK(values_read == values);
+
+    int step = 0;
+    BOOST_CHECK(try_read_attribute(grp, "step", step));
+    BOOST_CHECK_EQUAL(step, 42);
+    BOOST_CHECK_EQUAL(try_read_attribute(grp, "time", step).code(), status::not_found);
+
+    group sub;
+    BOOST_CHECK_EQUAL(try_open_group(grp, "missing", sub).code(), status::not_found);
+    BOOST_CHECK(!sub.valid());
+    BOOST_CHECK(!exists_group(grp, "missing"));     // not created
+    BOOST_CHECK(try_open_group(file, "subgroup", sub));
+    BOOST_CHECK(sub.valid());
+
+    // transfer errors are reported as status as well
+    BOOST_CHECK_NO_THROW(s = try_read_dataset(file, "present", step));
+    BOOST_CHECK_EQUAL(s.code(), status::type_mismatch);
+
+    // error messages of exceptions include the location
+    try {
+        dataset(file, "missing");
+        BOOST_ERROR("no exception thrown");
+    }
+    catch (error const& e) {
+        BOOST_CHECK_EQUAL(std::string(e.what()), "opening dataset \"missing\" at HDF5 object \"/\"");
+    }
+
+    // neither statuses nor exceptions keep the file open
+    char const other[] = "test_h5xx_dataset_try.h5";
+    h5xx::file f(other, h5xx::file::trunc);
+    std::vector<error> errors;
+    {
+        group root(f);
+        s = try_open_group(root, "missing", sub);
+        try {
+            dataset(root, "missing");
+        }
+        catch (error const& e) {
+            errors.push_back(e);
+        }
+    }
+    f.close();
+    BOOST_CHECK_NO_THROW(f.open(other, h5xx::file::trunc));
+    f.close();
+    BOOST_REQUIRE_EQUAL(errors.size(), 1u);
+    BOOST_CHECK_EQUAL(std::string(errors[0].what()), "opening dataset \"missing\" at HDF5 object \"/\"");
+    BOOST_CHECK_EQUAL(s.message(), "opening group \"missing\": not found");
+    unlink(other);
+}
+
 } //namespace fixture
@@ -14,6 +14,10 @@
 
 #include <h5xx/file.hpp>
 
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
 #include <unistd.h>
 #include <test/ctest_full_output.hpp>
 #include <test/catch_boost_no_throw.hpp>
@@ -105,3 +109,158 @@ BOOST_AUTO_TEST_CASE( hdf5_id )
     BOOST_CHECK(is_hdf5_file(name) > 0);
     unlink(name);
 }
+
+// test file creation and access options
+BOOST_AUTO_TEST_CASE( options )
+{
+    file_options opts;
+    opts.alignment = 4096;
+    opts.alignment_threshold = 1024;
+    opts.meta_block_size = 65536;
+    opts.sieve_buf_size = 1 << 20;
+    opts.paged_aggregation = true;
+    opts.page_size = 8192;
+    opts.page_buffer_size = 1 << 20;
+
+    BOOST_CHECK_NO_THROW(file f(name, opts, file::trunc));
+    file f(name, opts);                                        // re-open with page buffer
+
+    hid_t fapl = H5Fget_access_plist(f.hid());
+    hsize_t threshold, alignment, meta_block_size;
+    size_t sieve_buf_size;
+    H5Pget_alignment(fapl, &threshold, &alignment);
+    H5Pget_meta_block_size(fapl, &meta_block_size);
+    H5Pget_sieve_buf_size(fapl, &sieve_buf_size);
+    BOOST_CHECK_EQUAL(threshold, opts.alignment_threshold);
+    BOOST_CHECK_EQUAL(alignment, opts.alignment);
+    BOOST_CHECK_EQUAL(meta_block_size, opts.meta_block_size);
+    BOOST_CHECK_EQUAL(sieve_buf_size, opts.sieve_buf_size);
+    H5Pclose(fapl);
+
+    hid_t fcpl = H5Fget_create_plist(f.hid());
+    H5F_fspace_strategy_t strategy;
+    hbool_t persist;
+    hsize_t fs_threshold, page_size;
+    H5Pget_file_space_strategy(fcpl, &strategy, &persist, &fs_threshold);
+    H5Pget_file_space_page_size(fcpl, &page_size);
+    BOOST_CHECK_EQUAL(strategy, H5F_FSPACE_STRATEGY_PAGE);
+    BOOST_CHECK_EQUAL(page_size, opts.page_size);
+    H5Pclose(fcpl);
+    f.close();
+
+    // file format bounds
+    file_options latest;
+    latest.libver_low = H5F_LIBVER_LATEST;
+    f.open(name, latest, file::trunc);
+    fapl = H5Fget_access_plist(f.hid());
+    H5F_libver_t low, high;
+    H5Pget_libver_bounds(fapl, &low, &high);
+    BOOST_CHECK_EQUAL(low, H5F_LIBVER_LATEST);
+    BOOST_CHECK_EQUAL(high, H5F_LIBVER_LATEST);
+    H5Pclose(fapl);
+    f.close();
+
+    // page buffering of a file without paged aggregation fails
+    file_options paged;
+    paged.page_buffer_size = 1 << 20;
+    BOOST_CHECK_NO_THROW(file(name, file::trunc));
+    H5E_BEGIN_TRY {
+        BOOST_CHECK_THROW(file(name, paged), error);
+        BOOST_CHECK_THROW(f.open(name, paged), error);
+    } H5E_END_TRY
+    // a failed open leaves no access properties behind
+    f.open(name);
+    fapl = H5Fget_access_plist(f.hid());
+    size_t buf_size;
+    unsigned int min_meta_perc, min_raw_perc;
+    H5Pget_page_buffer_size(fapl, &buf_size, &min_meta_perc, &min_raw_perc);
+    BOOST_CHECK_EQUAL(buf_size, 0u);
+    H5Pclose(fapl);
+    f.close();
+    unlink(name);
+
+    // direct I/O, if supported by the HDF5 library and the file system
+    file_options direct;
+    direct.direct_io = true;
+#ifdef H5_HAVE_DIRECT
+    H5E_BEGIN_TRY {
+        try {
+            f.open(name, direct, file::trunc);
+        }
+        catch (error const&) {
+            BOOST_TEST_MESSAGE("file system does not support direct I/O");
+        }
+    } H5E_END_TRY
+    if (f.valid()) {
+        fapl = H5Fget_access_plist(f.hid());
+        BOOST_CHECK_EQUAL(H5Pget_driver(fapl), H5FD_DIRECT);
+        H5Pget_alignment(fapl, &threshold, &alignment);
+        BOOST_CHECK_EQUAL(alignment, direct.direct_block_size);
+        H5Pclose(fapl);
+        f.close();
+    }
+#else
+    BOOST_CHECK_THROW(file(name, direct, file::trunc), error);
+#endif
+    unlink(name);
+}
+
+// test the checks of write-behind options, the driver is not included here
+BOOST_AUTO_TEST_CASE( write_behind )
+{
+    file_options opts;
+    opts.write_behind = true;
+    BOOST_CHECK_EXCEPTION(file(name, opts, file::trunc), error, [](error const& e) {
+        return std::string(e.what()).find("requires h5xx/driver/write_behind.hpp") != std::string::npos;
+    });
+    BOOST_CHECK_EXCEPTION(file(name, opts, file::trunc | file::swmr_write), error, [](error const& e) {
+        return std::string(e.what()).find("SWMR access is not supported") != std::string::npos;
+    });
+    opts.direct_io = true;
+    BOOST_CHECK_EXCEPTION(file(name, opts, file::trunc), error, [](error const& e) {
+        return std::string(e.what()).find("mutually exclusive") != std::string::npos;
+    });
+    unlink(name);
+}
+
+// test tracing of file operations
+BOOST_AUTO_TEST_CASE( trace )
+{
+    char const* output = "test_h5xx_file_trace.json";
+    io_trace trace(output);
+    file_options opts;
+    opts.trace = &trace;
+
+    hsize_t dims = 1024;
+    std::vector<double> data(dims, 1.5);
+    hid_t space = H5Screate_simple(1, &dims, NULL);
+    file f(name, opts, file::trunc);
+    {
+        io_trace::scope s("/data");
+        hid_t dset = H5Dcreate(f.hid(), "data", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        BOOST_CHECK(H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data[0]) >= 0);
+        H5Dclose(dset);
+    }
+    H5Sclose(space);
+    BOOST_CHECK(io_trace::scope::label() == 0);
+    f.close();
+
+    io_trace::file_stats stats = trace.stats(name);
+    BOOST_CHECK_EQUAL(stats.total.write_raw.calls, 1u);
+    BOOST_CHECK_EQUAL(stats.total.write_raw.bytes, dims * sizeof(double));
+    BOOST_CHECK(stats.total.write_metadata.calls > 0);
+    BOOST_CHECK_EQUAL(stats.scopes.size(), 1u);
+    BOOST_CHECK_EQUAL(stats.scopes["/data"].write_raw.bytes, dims * sizeof(double));
+    unsigned long histogram = 0;
+    for (unsigned i = 0; i < io_counter::latency_bins; ++i) {
+        histogram += stats.total.write_metadata.latency[i];
+    }
+    BOOST_CHECK_EQUAL(histogram, stats.total.write_metadata.calls);
+
+    // statistics have been written upon closing
+    std::ifstream is(output);
+    std::string json((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    BOOST_CHECK(json.find("\"/data\": {\"read\"") != std::string::npos);
+    unlink(output);
+    unlink(name);
+}
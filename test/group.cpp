@@ -14,11 +14,14 @@
 #include <boost/test/unit_test.hpp>
 
 #include <h5xx/group.hpp>
+#include <h5xx/visit.hpp>
 
 #include <test/ctest_full_output.hpp>
 #include <test/catch_boost_no_throw.hpp>
 #include <test/fixture.hpp>
 
+#include <atomic>
+
 BOOST_GLOBAL_FIXTURE( ctest_full_output );
 
 namespace fixture { // preferred over BOOST_FIXTURE_TEST_SUITE
@@ -79,6 +82,44 @@ BOOST_AUTO_TEST_CASE( usage )
     BOOST_CHECK(get_name(four) == "/one/two/four");
 }
 
+BOOST_AUTO_TEST_CASE( options )
+{
+    group_options opts;
+    opts.max_compact = 16;
+    opts.min_dense = 8;
+    opts.est_num_entries = 10;
+    opts.track_order = true;
+    opts.index_order = true;
+
+    group grp;
+    BOOST_CHECK_NO_THROW(grp.open(file, "options", opts));
+
+    hid_t gcpl = H5Gget_create_plist(grp.hid());
+    unsigned int max_compact, min_dense, est_num_entries, est_name_len, crt_order_flags;
+    H5Pget_link_phase_change(gcpl, &max_compact, &min_dense);
+    H5Pget_est_link_info(gcpl, &est_num_entries, &est_name_len);
+    H5Pget_link_creation_order(gcpl, &crt_order_flags);
+    BOOST_CHECK_EQUAL(max_compact, 16u);
+    BOOST_CHECK_EQUAL(min_dense, 8u);
+    BOOST_CHECK_EQUAL(est_num_entries, 10u);
+    BOOST_CHECK_EQUAL(crt_order_flags, unsigned(H5P_CRT_ORDER_TRACKED | H5P_CRT_ORDER_INDEXED));
+    H5Pclose(gcpl);
+
+    // creation-order tracking implies the new-style, compact link storage
+    H5G_info_t info;
+    H5Gget_info(grp.hid(), &info);
+    BOOST_CHECK_EQUAL(info.storage_type, H5G_STORAGE_TYPE_COMPACT);
+
+    // options are ignored for existing groups
+    group_options other;
+    other.max_compact = 4;
+    group same(file, "options", other);
+    gcpl = H5Gget_create_plist(same.hid());
+    H5Pget_link_phase_change(gcpl, &max_compact, &min_dense);
+    BOOST_CHECK_EQUAL(max_compact, 16u);
+    H5Pclose(gcpl);
+}
+
 BOOST_AUTO_TEST_CASE( container_adapter )
 {
     // create empty group and test iterators of group/dataset containers
@@ -146,4 +187,134 @@ BOOST_AUTO_TEST_CASE( container_adapter )
     BOOST_CHECK_EQUAL(size, 2);
 }
 
+BOOST_AUTO_TEST_CASE( container_large )
+{
+    // names of a large group are collected in a single pass, in order of names
+    group large_group(file, "large");
+    const unsigned int ndset = 2000, ngroup = 500;
+    for (unsigned int i = 0; i < ndset; ++i) {
+        create_dataset<int>(large_group, "dset" + boost::lexical_cast<std::string>(i));
+    }
+    for (unsigned int i = 0; i < ngroup; ++i) {
+        group(large_group, "grp" + boost::lexical_cast<std::string>(i));
+    }
+
+    unsigned int size = 0;
+    std::string last;
+    auto datasets = large_group.datasets();
+    for (auto it = datasets.begin(); it != datasets.end(); ++it) {
+        BOOST_CHECK(it.get_name().compare(0, 4, "dset") == 0);
+        BOOST_CHECK(last < it.get_name());
+        last = it.get_name();
+        ++size;
+    }
+    BOOST_CHECK_EQUAL(size, ndset);
+
+    // dereferencing opens the object
+    size = 0;
+    for (auto const& grp : large_group.groups()) {
+        size += grp.valid();
+    }
+    BOOST_CHECK_EQUAL(size, ngroup);
+
+    // copies share the list of names, but advance independently
+    auto it = datasets.begin();
+    auto it2 = it;
+    ++it2;
+    BOOST_CHECK(it != it2);
+    BOOST_CHECK(++it == it2);
+    BOOST_CHECK_EQUAL(it.get_name(), it2.get_name());
+}
+
+BOOST_AUTO_TEST_CASE( visitor )
+{
+    group root(file, "tree");
+    group sub(root, "sub");
+    std::vector<size_t> chunk(1, 4);
+    create_dataset<int>(sub, "scalar");
+    create_dataset(root, "vector", ctype<double>::hid(), dataspace(std::vector<hsize_t>(1, 10))
+      , policy::storage::chunked(chunk).add(policy::filter::deflate()));
+
+    std::vector<object_info> entries = visit(root);
+    BOOST_REQUIRE_EQUAL(entries.size(), 4u);
+    BOOST_CHECK_EQUAL(entries[0].path, "/tree");
+    BOOST_CHECK_EQUAL(entries[0].type, H5O_TYPE_GROUP);
+    BOOST_CHECK_EQUAL(entries[1].path, "/tree/sub");
+    BOOST_CHECK_EQUAL(entries[2].path, "/tree/sub/scalar");
+    BOOST_CHECK_EQUAL(entries[2].type, H5O_TYPE_DATASET);
+    BOOST_CHECK(entries[2].shape.empty());
+    BOOST_CHECK_EQUAL(entries[2].dtype_class, H5T_INTEGER);
+    BOOST_CHECK_EQUAL(entries[2].dtype_size, sizeof(int));
+    BOOST_CHECK_EQUAL(entries[2].layout, H5D_COMPACT);
+    BOOST_CHECK_EQUAL(entries[3].path, "/tree/vector");
+    BOOST_REQUIRE_EQUAL(entries[3].shape.size(), 1u);
+    BOOST_CHECK_EQUAL(entries[3].shape[0], 10u);
+    BOOST_CHECK_EQUAL(entries[3].dtype_class, H5T_FLOAT);
+    BOOST_CHECK_EQUAL(entries[3].layout, H5D_CHUNKED);
+    BOOST_REQUIRE_EQUAL(entries[3].filters.size(), 1u);
+    BOOST_CHECK_EQUAL(entries[3].filters[0], H5Z_FILTER_DEFLATE);
+
+    // whole file, the root group is reported as "/"
+    BOOST_CHECK_EQUAL(visit(file).front().path, "/");
+
+    // parallel post-processing
+    std::atomic<unsigned int> ndatasets(0);
+    visit(root, [&ndatasets](object_info const& info) {
+        ndatasets += info.type == H5O_TYPE_DATASET;
+    }, 3);
+    BOOST_CHECK_EQUAL(ndatasets, 2u);
+
+    BOOST_CHECK_THROW(visit(root, [](object_info const&) { throw std::runtime_error("error"); }, 2), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( path_queries )
+{
+    group root(file, "tree");
+    group sub(root, "sub");
+    create_dataset<int>(sub, "scalar");
+    create_dataset(root, "vector", ctype<double>::hid(), dataspace(std::vector<hsize_t>(2, 5)));
+    H5Lcreate_soft("/tree/missing", root.hid(), "dangling", H5P_DEFAULT, H5P_DEFAULT);
+
+    // path components are checked one by one
+    BOOST_CHECK(exists_link(file, "tree/sub/scalar"));
+    BOOST_CHECK(exists_link(file, "/tree//sub/"));
+    BOOST_CHECK(exists_link(file, "/"));
+    BOOST_CHECK(!exists_link(file, "no/such/path"));
+    BOOST_CHECK(!exists_link(file, "tree/vector/below"));      // dataset in the middle
+    BOOST_CHECK(!exists_link(file, ""));
+    BOOST_CHECK(exists_link(root, "dangling"));
+    BOOST_CHECK(!exists_object(root, "dangling"));
+
+    BOOST_CHECK_EQUAL(get_object_type(file, "tree/sub"), H5O_TYPE_GROUP);
+    BOOST_CHECK_EQUAL(get_object_type(root, "sub/scalar"), H5O_TYPE_DATASET);
+    BOOST_CHECK_EQUAL(get_object_type(root, "sub/missing/scalar"), H5O_TYPE_UNKNOWN);
+    BOOST_CHECK(exists_dataset(file, "tree/sub/scalar"));
+    BOOST_CHECK(!exists_dataset(file, "tree/sub"));
+    BOOST_CHECK(!exists_dataset(file, "tree/missing/scalar"));
+    BOOST_CHECK(exists_group(root, "sub"));
+    BOOST_CHECK(!exists_group(root, "vector"));
+    BOOST_CHECK(!exists_group(root, "missing/sub"));
+
+    // "." and empty components are skipped
+    BOOST_CHECK(exists_group(file, "./tree"));
+    BOOST_CHECK(exists_group(file, "tree/./sub"));
+    BOOST_CHECK(exists_group(file, "tree/sub/."));
+    BOOST_CHECK(exists_dataset(file, "./tree//sub/./scalar"));
+    BOOST_CHECK(!exists_group(file, "./missing"));
+    BOOST_CHECK_NO_THROW(group(file, "./tree"));
+    BOOST_CHECK_NO_THROW(group(file, "tree/./sub"));
+
+    // type, shape, and layout in one call
+    object_info info = stat(root, "vector");
+    BOOST_CHECK_EQUAL(info.path, "/tree/vector");
+    BOOST_CHECK_EQUAL(info.type, H5O_TYPE_DATASET);
+    BOOST_REQUIRE_EQUAL(info.shape.size(), 2u);
+    BOOST_CHECK_EQUAL(info.shape[1], 5u);
+    BOOST_CHECK_EQUAL(info.dtype_class, H5T_FLOAT);
+    BOOST_CHECK_EQUAL(info.layout, H5D_CONTIGUOUS);
+    BOOST_CHECK_EQUAL(stat(file, "/tree/sub").type, H5O_TYPE_GROUP);
+    BOOST_CHECK_EQUAL(stat(file, "/tree/sub").path, "/tree/sub");
+    BOOST_CHECK_EQUAL(stat(file, "tree/none").type, H5O_TYPE_UNKNOWN);
+}
+
 } // namespace fixture
@@ -0,0 +1,92 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#define BOOST_TEST_MODULE h5xx_instrument
+#include <boost/test/unit_test.hpp>
+
+#include <h5xx/h5xx.hpp>
+#include <test/ctest_full_output.hpp>
+#include <test/catch_boost_no_throw.hpp>
+#include <test/fixture.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+BOOST_GLOBAL_FIXTURE( ctest_full_output );
+
+namespace fixture { // preferred over BOOST_FIXTURE_TEST_SUITE
+
+char filename[] = "test_h5xx_instrument.h5";
+typedef h5file<filename> BOOST_AUTO_TEST_CASE_FIXTURE;
+
+using namespace h5xx;
+
+BOOST_AUTO_TEST_CASE( recorder )
+{
+    instrument::registry& registry = instrument::registry::get();
+    registry.reset();
+
+    // no sink is installed by default
+    std::vector<double> values(100, 1.5), head(10);
+    dataset dset = create_dataset(file, "instrumented", values);
+    write_dataset(dset, values);
+    BOOST_CHECK(instrument::get_sink() == 0);
+    BOOST_CHECK(registry.snapshot().empty());
+
+    instrument::recorder recorder;
+    BOOST_CHECK(instrument::set_sink(&recorder) == 0);
+    write_dataset(dset, values);
+    read_dataset(dset, values);
+    read_dataset(dset, head, slice("0:10"));
+    write_attribute(dset, "step", 42);
+    BOOST_CHECK_EQUAL(read_attribute<int>(dset, "step"), 42);
+
+    instrument::registry::map_type stats = registry.snapshot();
+    BOOST_CHECK_EQUAL(stats.size(), 2u);
+    instrument::registry::entry const& entry = stats["/instrumented"];
+    BOOST_CHECK_EQUAL(entry.write.calls, 1u);
+    BOOST_CHECK_EQUAL(entry.write.bytes, 100 * sizeof(double));
+    BOOST_CHECK_EQUAL(entry.read.calls, 2u);
+    BOOST_CHECK_EQUAL(entry.read.bytes, 110 * sizeof(double));
+    BOOST_CHECK(entry.read.time >= 0);
+    BOOST_CHECK_EQUAL(stats["/instrumented@step"].write.bytes, sizeof(int));
+    BOOST_CHECK_EQUAL(stats["/instrumented@step"].read.calls, 1u);
+
+    std::ostringstream os;
+    registry.dump(os);
+    BOOST_CHECK(os.str().find("\"/instrumented@step\": {\"read\"") != std::string::npos);
+
+    // transfers of a batch and of read_all_attributes()
+    std::vector<int> ids(20, 7);
+    dataset dset_ids = create_dataset(file, "ids", ids);
+    write_attribute(dset, "name", std::string("particles"));
+    registry.reset();
+    dataset_batch batch;
+    batch.write(dset_ids, ids);
+    batch.read(dset, values);
+    BOOST_CHECK_NO_THROW(batch.execute());
+    attribute_map attributes = read_all_attributes(dset);
+    BOOST_CHECK_EQUAL(attributes.size(), 2u);
+
+    stats = registry.snapshot();
+    BOOST_CHECK_EQUAL(stats["/ids"].write.calls, 1u);
+    BOOST_CHECK_EQUAL(stats["/ids"].write.bytes, 20 * sizeof(int));
+    BOOST_CHECK_EQUAL(stats["/instrumented"].read.bytes, 100 * sizeof(double));
+    BOOST_CHECK_EQUAL(stats["/instrumented@step"].read.calls, 1u);
+    BOOST_CHECK_EQUAL(stats["/instrumented@name"].read.calls, 1u);
+
+    BOOST_CHECK(instrument::set_sink(0) == &recorder);
+    registry.reset();
+    read_dataset(dset, values);
+    BOOST_CHECK(registry.snapshot().empty());
+}
+
+} // namespace fixture
@@ -0,0 +1,135 @@
+/*
+ * Copyright © 2026 The h5xx contributors
+ * All rights reserved.
+ *
+ * This file is part of h5xx — a C++ wrapper for the HDF5 library.
+ *
+ * This software may be modified and distributed under the terms of the
+ * 3-clause BSD license.  See accompanying file LICENSE for details.
+ */
+
+#define BOOST_TEST_MODULE h5xx_write_behind
+#include <boost/test/unit_test.hpp>
+
+#include <h5xx/file.hpp>
+#include <h5xx/driver/write_behind.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <test/ctest_full_output.hpp>
+#include <test/catch_boost_no_throw.hpp>
+
+char const* name = "test_h5xx_write_behind.h5";
+
+using namespace h5xx;
+
+BOOST_GLOBAL_FIXTURE( ctest_full_output );
+
+// test write-behind buffering with many small writes
+BOOST_AUTO_TEST_CASE( write_behind )
+{
+    file_options opts;
+    opts.write_behind = true;
+    opts.write_behind_segment_size = 4096;                     // small segments to exercise the queue
+    opts.write_behind_queue_depth = 2;
+
+    int const count = 200;
+    hsize_t dims = 16;
+    hid_t space = H5Screate_simple(1, &dims, NULL);
+    hid_t scalar = H5Screate(H5S_SCALAR);
+    file f(name, opts, file::trunc);
+    {
+        hid_t fapl = H5Fget_access_plist(f.hid());
+        BOOST_CHECK_EQUAL(H5Pget_driver(fapl), detail::write_behind::driver_id());
+        H5Pclose(fapl);
+    }
+    for (int i = 0; i < count; ++i) {
+        std::vector<int> data(dims, i);
+        std::string dset_name = "dset" + boost::lexical_cast<std::string>(i);
+        hid_t dset = H5Dcreate(f.hid(), dset_name.c_str(), H5T_NATIVE_INT, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        BOOST_REQUIRE(dset >= 0);
+        BOOST_CHECK(H5Dwrite(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data[0]) >= 0);
+        hid_t attr = H5Acreate(dset, "index", H5T_NATIVE_INT, scalar, H5P_DEFAULT, H5P_DEFAULT);
+        BOOST_CHECK(H5Awrite(attr, H5T_NATIVE_INT, &i) >= 0);
+        H5Aclose(attr);
+        H5Dclose(dset);
+    }
+
+    // read back before closing, with part of the data still in flight
+    for (int i = 0; i < count; i += 17) {
+        std::vector<int> data(dims);
+        std::string dset_name = "dset" + boost::lexical_cast<std::string>(i);
+        hid_t dset = H5Dopen(f.hid(), dset_name.c_str(), H5P_DEFAULT);
+        BOOST_CHECK(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data[0]) >= 0);
+        BOOST_CHECK_EQUAL(data[dims - 1], i);
+        H5Dclose(dset);
+    }
+    BOOST_CHECK_NO_THROW(f.flush());
+    f.close();
+
+    // re-open with the default driver
+    f.open(name);
+    for (int i = 0; i < count; ++i) {
+        std::vector<int> data(dims);
+        int index = -1;
+        std::string dset_name = "dset" + boost::lexical_cast<std::string>(i);
+        hid_t dset = H5Dopen(f.hid(), dset_name.c_str(), H5P_DEFAULT);
+        BOOST_REQUIRE(dset >= 0);
+        BOOST_CHECK(H5Dread(dset, H5T_NATIVE_INT, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data[0]) >= 0);
+        hid_t attr = H5Aopen(dset, "index", H5P_DEFAULT);
+        H5Aread(attr, H5T_NATIVE_INT, &index);
+        H5Aclose(attr);
+        H5Dclose(dset);
+        BOOST_CHECK_EQUAL(data[0], i);
+        BOOST_CHECK_EQUAL(data[dims - 1], i);
+        BOOST_CHECK_EQUAL(index, i);
+    }
+    f.close();
+    H5Sclose(space);
+    H5Sclose(scalar);
+
+    // SWMR access and direct I/O are refused
+    BOOST_CHECK_EXCEPTION(file(name, opts, file::swmr_read), error, [](error const& e) {
+        return std::string(e.what()).find("SWMR access is not supported") != std::string::npos;
+    });
+    opts.direct_io = true;
+    BOOST_CHECK_EXCEPTION(file(name, opts, file::trunc), error, [](error const& e) {
+        return std::string(e.what()).find("mutually exclusive") != std::string::npos;
+    });
+    unlink(name);
+}
+
+// test tracing of reads on top of write-behind buffering
+BOOST_AUTO_TEST_CASE( trace )
+{
+    hsize_t dims = 1024;
+    std::vector<double> data(dims, 1.5);
+    hid_t space = H5Screate_simple(1, &dims, NULL);
+    file f(name, file::trunc);
+    hid_t dset = H5Dcreate(f.hid(), "data", H5T_NATIVE_DOUBLE, space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    BOOST_CHECK(H5Dwrite(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &data[0]) >= 0);
+    H5Dclose(dset);
+    H5Sclose(space);
+    f.close();
+
+    io_trace trace;
+    file_options opts;
+    opts.trace = &trace;
+    opts.write_behind = true;
+    f.open(name, opts, file::in);
+    {
+        io_trace::scope s("/data");
+        std::vector<double> result(dims);
+        hid_t dset = H5Dopen(f.hid(), "data", H5P_DEFAULT);
+        BOOST_CHECK(H5Dread(dset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &result[0]) >= 0);
+        H5Dclose(dset);
+        BOOST_CHECK(result == data);
+    }
+    f.close();
+    io_trace::file_stats stats = trace.stats(name);
+    BOOST_CHECK_EQUAL(stats.scopes["/data"].read_raw.bytes, dims * sizeof(double));
+    BOOST_CHECK_EQUAL(stats.total.write_raw.calls, 0u);
+    unlink(name);
+}